@@ -0,0 +1,163 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Monotonic allocator: bumps a pointer through chunks of ChunkBytes and never frees single
+    // objects. release() rewinds to the newest chunk, so a List of trivially destructible T
+    // clears in O(1). Every instance owns its chunks; copies start empty.
+    template<typename T, size_t ChunkBytes = 64 * 1024>
+    class Arena_Allocator
+    {
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        // slabs travel with the nodes they hold
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template<typename U>
+        struct rebind { using other = Arena_Allocator<U, ChunkBytes>; };
+
+    private:
+        static constexpr size_t align_ = std::max(alignof(T), alignof(std::max_align_t));
+
+        struct Chunk
+        {
+            Chunk* next_;
+            size_t bytes_;
+        };
+        static constexpr size_t header_ = (sizeof(Chunk) + align_ - 1) / align_ * align_;
+
+        Chunk* chunks_;
+        unsigned char* cur_;
+        unsigned char* end_;
+
+    public:
+        Arena_Allocator() noexcept : chunks_(nullptr), cur_(nullptr), end_(nullptr) {}
+
+        Arena_Allocator(const Arena_Allocator&) noexcept : Arena_Allocator() {}
+        template<typename U>
+        Arena_Allocator(const Arena_Allocator<U, ChunkBytes>&) noexcept : Arena_Allocator() {}
+        Arena_Allocator(Arena_Allocator&& other) noexcept;
+
+        Arena_Allocator& operator=(const Arena_Allocator&) noexcept { return *this; }
+        Arena_Allocator& operator=(Arena_Allocator&& other) noexcept;
+
+        T* allocate(size_t n);
+        void deallocate(T*, size_t) noexcept {}
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args) { ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+        template<typename U>
+        void destroy(U* p) { p->~U(); }
+
+        // Forgets every allocation; objects still living in the arena must be trivially destructible.
+        void release() noexcept;
+        // Bytes currently held in chunks, including space of objects already deallocated.
+        size_t reserved_bytes() const noexcept;
+
+        bool operator==(const Arena_Allocator& other) const noexcept { return this == &other; }
+        bool operator!=(const Arena_Allocator& other) const noexcept { return this != &other; }
+
+        ~Arena_Allocator() { free_chunks(); }
+
+    private:
+        static unsigned char* chunk_data(Chunk* chunk) { return reinterpret_cast<unsigned char*>(chunk) + header_; }
+        static void free_chunk(Chunk* chunk) noexcept { ::operator delete(chunk, std::align_val_t(align_)); }
+        void free_chunks() noexcept;
+    };
+
+    template<typename T, size_t ChunkBytes>
+    Arena_Allocator<T, ChunkBytes>::Arena_Allocator(Arena_Allocator&& other) noexcept
+        : chunks_(other.chunks_), cur_(other.cur_), end_(other.end_)
+    {
+        other.chunks_ = nullptr;
+        other.cur_ = nullptr;
+        other.end_ = nullptr;
+    }
+
+    template<typename T, size_t ChunkBytes>
+    Arena_Allocator<T, ChunkBytes>& Arena_Allocator<T, ChunkBytes>::operator=(Arena_Allocator&& other) noexcept
+    {
+        if(this == &other) { return *this; }
+        free_chunks();
+        chunks_ = std::exchange(other.chunks_, nullptr);
+        cur_ = std::exchange(other.cur_, nullptr);
+        end_ = std::exchange(other.end_, nullptr);
+        return *this;
+    }
+
+    template<typename T, size_t ChunkBytes>
+    T* Arena_Allocator<T, ChunkBytes>::allocate(size_t n)
+    {
+        if(n > (SIZE_MAX - header_ - alignof(T)) / sizeof(T)) { throw std::bad_alloc(); }
+
+        size_t bytes = n * sizeof(T);
+        auto aligned = [this]() {
+            auto addr = reinterpret_cast<std::uintptr_t>(cur_);
+            return cur_ + ((alignof(T) - addr % alignof(T)) % alignof(T));
+        };
+
+        unsigned char* place = aligned();
+        if(!cur_ || place > end_ || static_cast<size_t>(end_ - place) < bytes)
+        {
+            size_t chunk_bytes = std::max(ChunkBytes, bytes);
+            auto chunk = static_cast<Chunk*>(::operator new(header_ + chunk_bytes, std::align_val_t(align_)));
+            chunk->next_ = chunks_;
+            chunk->bytes_ = chunk_bytes;
+            chunks_ = chunk;
+            cur_ = chunk_data(chunk);
+            end_ = cur_ + chunk_bytes;
+            place = cur_;
+        }
+        cur_ = place + bytes;
+        return reinterpret_cast<T*>(place);
+    }
+
+    template<typename T, size_t ChunkBytes>
+    void Arena_Allocator<T, ChunkBytes>::release() noexcept
+    {
+        if(!chunks_) { return; }
+        while (chunks_->next_)
+        {
+            Chunk* del_chunk = chunks_->next_;
+            chunks_->next_ = del_chunk->next_;
+            free_chunk(del_chunk);
+        }
+        cur_ = chunk_data(chunks_);
+        end_ = cur_ + chunks_->bytes_;
+    }
+
+    template<typename T, size_t ChunkBytes>
+    size_t Arena_Allocator<T, ChunkBytes>::reserved_bytes() const noexcept
+    {
+        size_t bytes = 0;
+        for (Chunk* chunk = chunks_; chunk; chunk = chunk->next_) { bytes += header_ + chunk->bytes_; }
+        return bytes;
+    }
+
+    template<typename T, size_t ChunkBytes>
+    void Arena_Allocator<T, ChunkBytes>::free_chunks() noexcept
+    {
+        while (chunks_)
+        {
+            Chunk* del_chunk = chunks_;
+            chunks_ = chunks_->next_;
+            free_chunk(del_chunk);
+        }
+        cur_ = nullptr;
+        end_ = nullptr;
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "List.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Thread-safe FIFO on top of List that never holds more than capacity elements.
+    // Producers choose per call whether a full list rejects (try_push_back), blocks for a
+    // while (push_back with timeout) or evicts its oldest element (push_back_evict).
+    // Consumers take elements one by one or drain everything in one O(1) splice.
+    template<typename T, typename Allocator = std::allocator<T>>
+    class Bounded_List
+    {
+    private:
+        List<T, Allocator> list_;
+        size_t capacity_;
+        mutable std::mutex lock_;
+        std::condition_variable not_full_;
+        std::condition_variable not_empty_;
+
+    public:
+        explicit Bounded_List(size_t capacity) : list_(), capacity_(capacity), lock_(), not_full_(), not_empty_() {}
+
+        Bounded_List(const Bounded_List& copy_list) = delete;
+        Bounded_List& operator=(const Bounded_List& copy_list) = delete;
+
+        size_t capacity() const { return capacity_; }
+        size_t size() const;
+        bool empty() const { return !size(); }
+
+        template<typename U = T>
+        bool try_push_back(U&& el);
+        template<typename U, typename Rep, typename Period>
+        bool push_back(U&& el, const std::chrono::duration<Rep, Period>& timeout);
+        // Returns true if the oldest element had to be dropped to make room.
+        template<typename U = T>
+        bool push_back_evict(U&& el);
+
+        bool try_pop_front(T& out);
+        template<typename Rep, typename Period>
+        bool pop_front(T& out, const std::chrono::duration<Rep, Period>& timeout);
+
+        // Moves every queued element to the back of out; returns how many were moved.
+        size_t drain(List<T, Allocator>& out);
+
+    private:
+        template<typename U>
+        void push_locked(U&& el);
+        void pop_locked(T& out);
+    };
+
+    template<typename T, typename Allocator>
+    size_t Bounded_List<T, Allocator>::size() const
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        return list_.size();
+    }
+
+    template<typename T, typename Allocator>
+    template<typename U>
+    bool Bounded_List<T, Allocator>::try_push_back(U&& el)
+    {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if(list_.size() >= capacity_) { return false; }
+            push_locked(std::forward<U>(el));
+        }
+        not_empty_.notify_one();
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename U, typename Rep, typename Period>
+    bool Bounded_List<T, Allocator>::push_back(U&& el, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+            if(!not_full_.wait_for(lock, timeout, [this]() { return list_.size() < capacity_; })) { return false; }
+            push_locked(std::forward<U>(el));
+        }
+        not_empty_.notify_one();
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename U>
+    bool Bounded_List<T, Allocator>::push_back_evict(U&& el)
+    {
+        bool evicted = false;
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if(!capacity_) { return true; }
+            if(list_.size() < capacity_) {
+                push_locked(std::forward<U>(el));
+            } else {
+                evicted = true;
+                if constexpr (std::is_nothrow_assignable_v<T&, U&&>) {
+                    // recycle the oldest node as the newest one instead of freeing and allocating
+                    list_.front() = std::forward<U>(el);
+                    list_.splice(list_.end(), list_, list_.begin());
+                } else {
+                    // the new element must exist before the oldest goes, so a throw changes nothing
+                    push_locked(std::forward<U>(el));
+                    list_.pop_front();
+                }
+            }
+        }
+        not_empty_.notify_one();
+        return evicted;
+    }
+
+    template<typename T, typename Allocator>
+    bool Bounded_List<T, Allocator>::try_pop_front(T& out)
+    {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            if(list_.empty()) { return false; }
+            pop_locked(out);
+        }
+        not_full_.notify_one();
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Rep, typename Period>
+    bool Bounded_List<T, Allocator>::pop_front(T& out, const std::chrono::duration<Rep, Period>& timeout)
+    {
+        {
+            std::unique_lock<std::mutex> lock(lock_);
+            if(!not_empty_.wait_for(lock, timeout, [this]() { return !list_.empty(); })) { return false; }
+            pop_locked(out);
+        }
+        not_full_.notify_one();
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    size_t Bounded_List<T, Allocator>::drain(List<T, Allocator>& out)
+    {
+        size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            count = list_.size();
+            out.splice(out.end(), list_);
+        }
+        if(count) { not_full_.notify_all(); }
+        return count;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename U>
+    void Bounded_List<T, Allocator>::push_locked(U&& el)
+    {
+        list_.push_back(std::forward<U>(el));
+    }
+
+    template<typename T, typename Allocator>
+    void Bounded_List<T, Allocator>::pop_locked(T& out)
+    {
+        out = std::move(list_.front());
+        list_.pop_front();
+    }
+    //----------------------------------------------------------------------------------
+}
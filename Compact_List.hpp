@@ -0,0 +1,464 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    template<typename T, typename Index>
+    struct Compact_Node
+    {
+        Index next_;
+        Index prev_;
+        alignas(T) unsigned char storage_[sizeof(T)];
+
+        T* data() { return std::launder(reinterpret_cast<T*>(storage_)); }
+    };
+
+    //----------------------------------------------------------------------------------
+    // Refers to its list's node array rather than to a node, so it survives pool growth.
+    template<typename T, typename Index, bool IsConst>
+    class Compact_Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        Compact_Node<T, Index>* const* nodes_;
+        Index idx_;
+
+        Compact_Iterator(Compact_Node<T, Index>* const* nodes, Index idx) : nodes_(nodes), idx_(idx) {}
+        Compact_Iterator(const Compact_Iterator& it) = default;
+        Compact_Iterator& operator=(const Compact_Iterator& it) = default;
+        template<bool C = IsConst, typename = std::enable_if_t<C>>
+        Compact_Iterator(const Compact_Iterator<T, Index, false>& it) : nodes_(it.nodes_), idx_(it.idx_) {}
+
+        reference operator*() const { return *node().data(); }
+        pointer operator->() const { return node().data(); }
+
+        Compact_Iterator& operator++() {
+            idx_ = node().next_;
+            return *this;
+        }
+        Compact_Iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Compact_Iterator& operator--() {
+            idx_ = node().prev_;
+            return *this;
+        }
+        Compact_Iterator operator--(int) {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Compact_Iterator& it) const { return idx_ == it.idx_; }
+        bool operator!=(const Compact_Iterator& it) const { return idx_ != it.idx_; }
+
+    private:
+        Compact_Node<T, Index>& node() const { return (*nodes_)[idx_]; }
+    };
+
+    //----------------------------------------------------------------------------------
+    // Doubly-linked list whose nodes live in one contiguous pool and link by Index instead of
+    // by pointer, so a List<uint32_t> node shrinks from 24 to 12 bytes. Slot 0 is the sentinel
+    // and freed slots are recycled before the pool grows. Growth relocates the pool: iterators
+    // stay valid, pointers and references to elements do not. Links are position-independent,
+    // so a pool of trivially copyable T can be copied byte-wise.
+    template<typename T, typename Index = uint32_t, typename Allocator = std::allocator<T>>
+    class Compact_List
+    {
+        static_assert(std::is_unsigned_v<Index>, "Compact_List needs an unsigned index type");
+
+    private:
+        using Node = Compact_Node<T, Index>;
+        using Node_Alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using Node_Traits = std::allocator_traits<Node_Alloc>;
+
+        // moves and swap only hand the pool over when the allocator can free it afterwards
+        static constexpr bool nothrow_move_ = Node_Traits::propagate_on_container_move_assignment::value
+            || Node_Traits::is_always_equal::value;
+        static constexpr bool nothrow_swap_ = Node_Traits::propagate_on_container_swap::value
+            || Node_Traits::is_always_equal::value;
+
+    public:
+        using iterator = Compact_Iterator<T, Index, false>;
+        using const_iterator = Compact_Iterator<T, Index, true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        Node* nodes_;
+        Node_Alloc node_alloc_;
+        size_t capacity_;
+        size_t used_;
+        Index free_;
+        size_t sz_;
+
+    public:
+        Compact_List() : Compact_List(Allocator()) {}
+        explicit Compact_List(const Allocator& alloc);
+        Compact_List(std::initializer_list<T> init);
+
+        Compact_List(const Compact_List& copy_list);
+        Compact_List(Compact_List&& move_list) noexcept(nothrow_move_);
+        Compact_List& operator=(const Compact_List& copy_list);
+        Compact_List& operator=(Compact_List&& move_list) noexcept(nothrow_move_);
+
+        size_t size() const { return sz_; }
+        bool empty() const { return !sz_; }
+        size_t capacity() const { return capacity_ ? capacity_ - 1 : 0; }
+        static constexpr size_t max_size() { return std::min<uintmax_t>(std::numeric_limits<Index>::max(), SIZE_MAX / sizeof(Node)); }
+        void reserve(size_t count);
+        void clear();
+
+        T& front() { return *begin(); }
+        const T& front() const { return *begin(); }
+
+        T& back() { return *(--end()); }
+        const T& back() const { return *(--end()); }
+
+        template<typename U = T>
+        void push_front(U&& el) { emplace(begin(), std::forward<U>(el)); }
+        template<typename U = T>
+        void push_back(U&& el) { emplace(end(), std::forward<U>(el)); }
+
+        template<typename... Args>
+        T& emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+        template<typename... Args>
+        T& emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+
+        void pop_front() { erase(begin()); }
+        void pop_back() { erase(--end()); }
+
+        template<typename U = T>
+        iterator insert(const_iterator it, U&& el) { return emplace(it, std::forward<U>(el)); }
+        template<typename... Args>
+        iterator emplace(const_iterator it, Args&&... args);
+        iterator erase(const_iterator it);
+
+        void swap(Compact_List& other) noexcept(nothrow_swap_);
+
+        iterator begin() { return {&nodes_, head().next_}; }
+        iterator end() { return {&nodes_, 0}; }
+
+        const_iterator begin() const { return {&nodes_, head().next_}; }
+        const_iterator end() const { return {&nodes_, 0}; }
+
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        const_reverse_iterator crbegin() const { return rbegin(); }
+        const_reverse_iterator crend() const { return rend(); }
+
+    private:
+        // an empty list has no pool yet; this stands in for its sentinel
+        static Node* empty_head() { static Node head{0, 0, {}}; return &head; }
+        Node& head() const { return *nodes_; }
+
+        Index acquire_slot();
+        void grow(size_t new_capacity);
+        void release_pool() noexcept;
+        void take_pool(Compact_List& other) noexcept;
+        void move_elements(Compact_List& other);
+
+    public:
+        ~Compact_List();
+    };
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>::Compact_List(const Allocator& alloc)
+        : nodes_(empty_head()), node_alloc_(alloc), capacity_(0), used_(0), free_(0), sz_(0) {}
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>::Compact_List(std::initializer_list<T> init) : Compact_List()
+    {
+        reserve(init.size());
+        for (const T& el : init)
+        {
+            push_back(el);
+        }
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>::Compact_List(const Compact_List& copy_list)
+        : Compact_List(Allocator(Node_Traits::select_on_container_copy_construction(copy_list.node_alloc_)))
+    {
+        reserve(copy_list.size());
+        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
+        {
+            push_back(*it);
+        }
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>::Compact_List(Compact_List&& move_list) noexcept(nothrow_move_)
+        : nodes_(empty_head()), node_alloc_(std::move(move_list.node_alloc_)), capacity_(0), used_(0), free_(0), sz_(0)
+    {
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            take_pool(move_list);
+        } else {
+            if(node_alloc_ == move_list.node_alloc_) {
+                take_pool(move_list);
+            } else {
+                move_elements(move_list);
+            }
+        }
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>& Compact_List<T, Index, Allocator>::operator=(const Compact_List& copy_list)
+    {
+        if(this == &copy_list) { return *this; }
+        if constexpr (Node_Traits::propagate_on_container_copy_assignment::value) {
+            if(node_alloc_ != copy_list.node_alloc_)
+            {
+                // the pool must go back to the allocator that made it before that is replaced
+                release_pool();
+                node_alloc_ = copy_list.node_alloc_;
+            }
+        }
+        // built with this list's allocator, so the swap below only exchanges pools
+        Compact_List tmp((Allocator(node_alloc_)));
+        tmp.reserve(copy_list.size());
+        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
+        {
+            tmp.push_back(*it);
+        }
+        swap(tmp);
+        return *this;
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>& Compact_List<T, Index, Allocator>::operator=(Compact_List&& move_list) noexcept(nothrow_move_)
+    {
+        if(this == &move_list) { return *this; }
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            release_pool();
+            node_alloc_ = std::move(move_list.node_alloc_);
+        } else {
+            if(node_alloc_ != move_list.node_alloc_)
+            {
+                // a pool owned by another allocator cannot be adopted
+                clear();
+                move_elements(move_list);
+                return *this;
+            }
+            release_pool();
+        }
+        take_pool(move_list);
+        return *this;
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::reserve(size_t count)
+    {
+        if(count >= max_size()) { throw std::length_error("Compact_List::reserve"); }
+        if(count > capacity()) { grow(count + 1); }
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::clear()
+    {
+        if(!capacity_) { return; }
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (Index idx = head().next_; idx != 0; idx = nodes_[idx].next_)
+            {
+                std::destroy_at(nodes_[idx].data());
+            }
+        }
+        head().next_ = 0;
+        head().prev_ = 0;
+        used_ = 1;
+        free_ = 0;
+        sz_ = 0;
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    template<typename... Args>
+    typename Compact_List<T, Index, Allocator>::iterator Compact_List<T, Index, Allocator>::emplace(const_iterator it, Args&&... args)
+    {
+        Index pos = it.idx_;
+        Index idx = acquire_slot();
+        Node& node = nodes_[idx];
+        try {
+            ::new(static_cast<void*>(node.storage_)) T(std::forward<Args>(args)...);
+        } catch(...) {
+            node.next_ = free_;
+            free_ = idx;
+            throw;
+        }
+        node.next_ = pos;
+        node.prev_ = nodes_[pos].prev_;
+        nodes_[node.prev_].next_ = idx;
+        nodes_[pos].prev_ = idx;
+        ++sz_;
+        return iterator(&nodes_, idx);
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    typename Compact_List<T, Index, Allocator>::iterator Compact_List<T, Index, Allocator>::erase(const_iterator it)
+    {
+        Index idx = it.idx_;
+        Node& node = nodes_[idx];
+        Index next = node.next_;
+        nodes_[node.prev_].next_ = next;
+        nodes_[next].prev_ = node.prev_;
+        std::destroy_at(node.data());
+        node.next_ = free_;
+        free_ = idx;
+        --sz_;
+        return iterator(&nodes_, next);
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::swap(Compact_List& other) noexcept(nothrow_swap_)
+    {
+        if(this == &other) { return; }
+        if constexpr (!Node_Traits::propagate_on_container_swap::value) {
+            if(node_alloc_ != other.node_alloc_)
+            {
+                Compact_List tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+                return;
+            }
+        }
+
+        using std::swap;
+        swap(nodes_, other.nodes_);
+        if constexpr (Node_Traits::propagate_on_container_swap::value) {
+            swap(node_alloc_, other.node_alloc_);
+        }
+        swap(capacity_, other.capacity_);
+        swap(used_, other.used_);
+        swap(free_, other.free_);
+        swap(sz_, other.sz_);
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    Index Compact_List<T, Index, Allocator>::acquire_slot()
+    {
+        if(free_)
+        {
+            Index idx = free_;
+            free_ = nodes_[idx].next_;
+            return idx;
+        }
+        if(used_ == capacity_)
+        {
+            if(capacity_ == max_size()) { throw std::length_error("Compact_List: index space exhausted"); }
+            grow(capacity_ < 16 ? 16 : capacity_ > max_size() / 2 ? max_size() : capacity_ * 2);
+        }
+        return static_cast<Index>(used_++);
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::grow(size_t new_capacity)
+    {
+        Node* new_nodes = Node_Traits::allocate(node_alloc_, new_capacity);
+        if(!capacity_)
+        {
+            new_nodes[0].next_ = 0;
+            new_nodes[0].prev_ = 0;
+            nodes_ = new_nodes;
+            capacity_ = new_capacity;
+            used_ = 1;
+            return;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void*>(new_nodes), nodes_, used_ * sizeof(Node));
+        } else {
+            // free slots carry only a link, live ones are moved along the chain
+            for (size_t i = 0; i < used_; ++i)
+            {
+                new_nodes[i].next_ = nodes_[i].next_;
+                new_nodes[i].prev_ = nodes_[i].prev_;
+            }
+            Index idx = head().next_;
+            try {
+                for (; idx != 0; idx = nodes_[idx].next_)
+                {
+                    ::new(static_cast<void*>(new_nodes[idx].storage_)) T(std::move_if_noexcept(*nodes_[idx].data()));
+                }
+            } catch(...) {
+                for (Index done = head().next_; done != idx; done = nodes_[done].next_)
+                {
+                    std::destroy_at(new_nodes[done].data());
+                }
+                Node_Traits::deallocate(node_alloc_, new_nodes, new_capacity);
+                throw;
+            }
+            for (idx = head().next_; idx != 0; idx = nodes_[idx].next_)
+            {
+                std::destroy_at(nodes_[idx].data());
+            }
+        }
+        Node_Traits::deallocate(node_alloc_, nodes_, capacity_);
+        nodes_ = new_nodes;
+        capacity_ = new_capacity;
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::release_pool() noexcept
+    {
+        clear();
+        if(capacity_) { Node_Traits::deallocate(node_alloc_, nodes_, capacity_); }
+        nodes_ = empty_head();
+        capacity_ = 0;
+        used_ = 0;
+    }
+
+    // Adopts other's pool; this list must not have one.
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::take_pool(Compact_List& other) noexcept
+    {
+        nodes_ = std::exchange(other.nodes_, empty_head());
+        capacity_ = std::exchange(other.capacity_, 0);
+        used_ = std::exchange(other.used_, 0);
+        free_ = std::exchange(other.free_, 0);
+        sz_ = std::exchange(other.sz_, 0);
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    void Compact_List<T, Index, Allocator>::move_elements(Compact_List& other)
+    {
+        reserve(other.size());
+        for (auto it = other.begin(); it != other.end(); ++it)
+        {
+            push_back(std::move(*it));
+        }
+        other.clear();
+    }
+
+    template<typename T, typename Index, typename Allocator>
+    Compact_List<T, Index, Allocator>::~Compact_List()
+    {
+        release_pool();
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,392 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // next_ and prev_ of a linked node change only while that node is locked; marked_ is set with
+    // the node, its predecessor and its successor locked, after which neither link changes again.
+    struct Concurrent_Link
+    {
+        std::atomic<Concurrent_Link*> next_;
+        std::atomic<Concurrent_Link*> prev_;
+        std::atomic<bool> marked_;
+        std::mutex lock_;
+        Concurrent_Link* retired_next_;
+
+        Concurrent_Link() : next_(nullptr), prev_(nullptr), marked_(false), lock_(), retired_next_(nullptr) {}
+        Concurrent_Link(const Concurrent_Link& link) = delete;
+        Concurrent_Link& operator=(const Concurrent_Link& link) = delete;
+    };
+
+    template<typename T>
+    struct Concurrent_Node : Concurrent_Link
+    {
+        T data_;
+
+        template<typename... Args>
+        explicit Concurrent_Node(Args&&... args) : Concurrent_Link(), data_(std::forward<Args>(args)...) {}
+    };
+
+    //----------------------------------------------------------------------------------
+    // Walks live elements only; marked (logically erased) nodes are skipped.
+    template<typename T>
+    class Concurrent_Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using pointer = const T*;
+        using reference = const T&;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        Concurrent_Link* node_;
+
+        Concurrent_Iterator(Concurrent_Link* node) : node_(node) { skip_forward(); }
+        Concurrent_Iterator(const Concurrent_Iterator& it) = default;
+        Concurrent_Iterator& operator=(const Concurrent_Iterator& it) = default;
+
+        reference operator*() const { return static_cast<Concurrent_Node<T>*>(node_)->data_; }
+        pointer operator->() const { return &static_cast<Concurrent_Node<T>*>(node_)->data_; }
+
+        Concurrent_Iterator& operator++() {
+            node_ = node_->next_.load(std::memory_order_acquire);
+            skip_forward();
+            return *this;
+        }
+        Concurrent_Iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Concurrent_Iterator& operator--() {
+            do {
+                node_ = node_->prev_.load(std::memory_order_acquire);
+            } while (node_->marked_.load(std::memory_order_acquire));
+            return *this;
+        }
+        Concurrent_Iterator operator--(int) {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Concurrent_Iterator& it) const { return node_ == it.node_; }
+        bool operator!=(const Concurrent_Iterator& it) const { return node_ != it.node_; }
+
+    private:
+        void skip_forward() {
+            while (node_->marked_.load(std::memory_order_acquire))
+            {
+                node_ = node_->next_.load(std::memory_order_acquire);
+            }
+        }
+    };
+
+    //----------------------------------------------------------------------------------
+    // Ordered set on List's doubly-linked layout, using the lazy-list scheme: writers search
+    // without locks, lock the nodes they relink, then validate. Elements are unique and kept
+    // in Compare order, so there is no positional insert; every erase goes by key.
+    // Erase marks a node before unlinking it, so contains() and readers never lock or retry.
+    //
+    // Unlinked nodes are reclaimed by epoch: each Reader (and each operation) registers in
+    // the current epoch's parity, and a retired batch is freed two epoch flips later, once
+    // every Reader that could have seen it has gone. Short-lived readers therefore never hold
+    // memory back for long; a single Reader kept alive pins everything retired after it
+    // started until it ends. Allocator must be thread-safe.
+    template<typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+    class Concurrent_List
+    {
+    private:
+        using Node = Concurrent_Node<T>;
+        using Node_Alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using Node_Traits = std::allocator_traits<Node_Alloc>;
+
+    public:
+        using const_iterator = Concurrent_Iterator<T>;
+
+        // Keeps every node reachable from begin() alive while it exists.
+        class Reader
+        {
+        public:
+            explicit Reader(const Concurrent_List& list) : list_(&list), slot_(list.enter()) {}
+            Reader(const Reader& reader) = delete;
+            Reader& operator=(const Reader& reader) = delete;
+            Reader(Reader&& reader) noexcept : list_(std::exchange(reader.list_, nullptr)), slot_(reader.slot_) {}
+            ~Reader() { if(list_) { list_->leave(slot_); } }
+
+            const_iterator begin() const { return {list_->head_.next_.load(std::memory_order_acquire)}; }
+            const_iterator end() const { return {const_cast<Concurrent_Link*>(&list_->tail_)}; }
+
+        private:
+            const Concurrent_List* list_;
+            size_t slot_;
+        };
+
+    private:
+        Concurrent_Link head_;
+        Concurrent_Link tail_;
+        Compare comp_;
+        Node_Alloc node_alloc_;
+        std::atomic<size_t> sz_;
+
+        // readers_[e & 1] counts the readers that entered during epoch e; retired_ holds nodes
+        // unlinked during the current epoch, pending_ those unlinked during the one before
+        std::atomic<size_t> epoch_;
+        mutable std::atomic<size_t> readers_[2];
+        std::mutex retire_lock_;
+        Concurrent_Link* retired_;
+        Concurrent_Link* pending_;
+
+    public:
+        explicit Concurrent_List(Compare comp = Compare());
+
+        Concurrent_List(const Concurrent_List& copy_list) = delete;
+        Concurrent_List& operator=(const Concurrent_List& copy_list) = delete;
+
+        size_t size() const { return sz_.load(std::memory_order_relaxed); }
+        bool empty() const { return !size(); }
+
+        template<typename U = T>
+        bool insert(U&& el);
+        bool erase(const T& el);
+        // Erases the element it refers to, which for a set is the one equal to *it;
+        // it must come from a Reader that is still alive.
+        bool erase(const_iterator it) { return erase(*it); }
+        bool contains(const T& el) const;
+
+        Reader read() const { return Reader(*this); }
+
+        ~Concurrent_List();
+
+    private:
+        static const T& data(Concurrent_Link* link) { return static_cast<Node*>(link)->data_; }
+
+        size_t enter() const;
+        void leave(size_t slot) const { readers_[slot].fetch_sub(1, std::memory_order_seq_cst); }
+
+        void locate(const T& el, Concurrent_Link*& pred, Concurrent_Link*& curr) const;
+        bool validate(Concurrent_Link* pred, Concurrent_Link* curr) const;
+        bool is_equal(Concurrent_Link* curr, const T& el) const;
+
+        template<typename U>
+        Node* obj_construct(U&& el);
+        void obj_destruct(Concurrent_Link* del_node);
+        void free_batch(Concurrent_Link* batch);
+        void retire(Concurrent_Link* del_node);
+        void reclaim();
+    };
+
+    template<typename T, typename Compare, typename Allocator>
+    Concurrent_List<T, Compare, Allocator>::Concurrent_List(Compare comp)
+        : head_(), tail_(), comp_(std::move(comp)), node_alloc_(), sz_(0), epoch_(0), readers_{0, 0},
+          retire_lock_(), retired_(nullptr), pending_(nullptr)
+    {
+        head_.next_.store(&tail_, std::memory_order_relaxed);
+        tail_.prev_.store(&head_, std::memory_order_relaxed);
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    template<typename U>
+    bool Concurrent_List<T, Compare, Allocator>::insert(U&& el)
+    {
+        Node* new_node = obj_construct(std::forward<U>(el));
+
+        bool inserted = false;
+        {
+            Reader reader(*this);
+            while (true)
+            {
+                Concurrent_Link* pred = nullptr;
+                Concurrent_Link* curr = nullptr;
+                locate(new_node->data_, pred, curr);
+
+                std::scoped_lock lock(pred->lock_, curr->lock_);
+                if(!validate(pred, curr)) { continue; }
+                if(is_equal(curr, new_node->data_)) { break; }
+
+                new_node->next_.store(curr, std::memory_order_relaxed);
+                new_node->prev_.store(pred, std::memory_order_relaxed);
+                curr->prev_.store(new_node, std::memory_order_release);
+                pred->next_.store(new_node, std::memory_order_release);
+                sz_.fetch_add(1, std::memory_order_relaxed);
+                inserted = true;
+                break;
+            }
+        }
+
+        if(!inserted) { obj_destruct(new_node); }
+        return inserted;
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    bool Concurrent_List<T, Compare, Allocator>::erase(const T& el)
+    {
+        bool erased = false;
+        {
+            Reader reader(*this);
+            while (true)
+            {
+                Concurrent_Link* pred = nullptr;
+                Concurrent_Link* curr = nullptr;
+                locate(el, pred, curr);
+
+                std::scoped_lock lock(pred->lock_, curr->lock_);
+                if(!validate(pred, curr)) { continue; }
+                if(!is_equal(curr, el)) { break; }
+
+                // curr is locked, so its successor is stable and still linked; locking it
+                // after pred and curr keeps every thread acquiring in list order
+                Concurrent_Link* next = curr->next_.load(std::memory_order_acquire);
+                std::lock_guard<std::mutex> next_lock(next->lock_);
+                curr->marked_.store(true, std::memory_order_release);
+                next->prev_.store(pred, std::memory_order_release);
+                pred->next_.store(next, std::memory_order_release);
+                sz_.fetch_sub(1, std::memory_order_relaxed);
+                retire(curr);
+                erased = true;
+                break;
+            }
+        }
+
+        if(erased) { reclaim(); }
+        return erased;
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    bool Concurrent_List<T, Compare, Allocator>::contains(const T& el) const
+    {
+        Reader reader(*this);
+        Concurrent_Link* curr = head_.next_.load(std::memory_order_acquire);
+        while (curr != &tail_ && comp_(data(curr), el))
+        {
+            curr = curr->next_.load(std::memory_order_acquire);
+        }
+        return is_equal(curr, el) && !curr->marked_.load(std::memory_order_acquire);
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    void Concurrent_List<T, Compare, Allocator>::locate(const T& el, Concurrent_Link*& pred, Concurrent_Link*& curr) const
+    {
+        pred = const_cast<Concurrent_Link*>(&head_);
+        curr = pred->next_.load(std::memory_order_acquire);
+        while (curr != &tail_ && comp_(data(curr), el))
+        {
+            pred = curr;
+            curr = curr->next_.load(std::memory_order_acquire);
+        }
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    bool Concurrent_List<T, Compare, Allocator>::validate(Concurrent_Link* pred, Concurrent_Link* curr) const
+    {
+        return !pred->marked_.load(std::memory_order_acquire) && !curr->marked_.load(std::memory_order_acquire)
+            && pred->next_.load(std::memory_order_acquire) == curr;
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    bool Concurrent_List<T, Compare, Allocator>::is_equal(Concurrent_Link* curr, const T& el) const
+    {
+        return curr != &tail_ && !comp_(el, data(curr));
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    size_t Concurrent_List<T, Compare, Allocator>::enter() const
+    {
+        // register under the epoch seen, then make sure no flip slipped in before the count landed
+        while (true)
+        {
+            size_t epoch = epoch_.load(std::memory_order_seq_cst);
+            size_t slot = epoch & 1;
+            readers_[slot].fetch_add(1, std::memory_order_seq_cst);
+            if(epoch_.load(std::memory_order_seq_cst) == epoch) { return slot; }
+            readers_[slot].fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    template<typename U>
+    typename Concurrent_List<T, Compare, Allocator>::Node* Concurrent_List<T, Compare, Allocator>::obj_construct(U&& el)
+    {
+        Node* new_node = Node_Traits::allocate(node_alloc_, 1);
+        try {
+            Node_Traits::construct(node_alloc_, new_node, std::forward<U>(el));
+        } catch(...) {
+            Node_Traits::deallocate(node_alloc_, new_node, 1);
+            throw;
+        }
+        return new_node;
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    void Concurrent_List<T, Compare, Allocator>::obj_destruct(Concurrent_Link* del_node)
+    {
+        Node* node = static_cast<Node*>(del_node);
+        Node_Traits::destroy(node_alloc_, node);
+        Node_Traits::deallocate(node_alloc_, node, 1);
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    void Concurrent_List<T, Compare, Allocator>::free_batch(Concurrent_Link* batch)
+    {
+        while (batch)
+        {
+            Concurrent_Link* del_node = batch;
+            batch = batch->retired_next_;
+            obj_destruct(del_node);
+        }
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    void Concurrent_List<T, Compare, Allocator>::retire(Concurrent_Link* del_node)
+    {
+        std::lock_guard<std::mutex> lock(retire_lock_);
+        del_node->retired_next_ = retired_;
+        retired_ = del_node;
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    void Concurrent_List<T, Compare, Allocator>::reclaim()
+    {
+        // pending_ was unlinked before the flip into this epoch, so only readers of the previous
+        // epoch can still hold it; once they are gone it can go, and the nodes retired so far
+        // wait out the current epoch's readers in its place. A quiet list gets through both
+        // flips at once.
+        for (int flip = 0; flip < 2; ++flip)
+        {
+            Concurrent_Link* batch = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(retire_lock_);
+                if(!pending_ && !retired_) { return; }
+                size_t epoch = epoch_.load(std::memory_order_seq_cst);
+                if(readers_[(epoch + 1) & 1].load(std::memory_order_seq_cst)) { return; }
+                batch = std::exchange(pending_, std::exchange(retired_, nullptr));
+                epoch_.store(epoch + 1, std::memory_order_seq_cst);
+            }
+            free_batch(batch);
+        }
+    }
+
+    template<typename T, typename Compare, typename Allocator>
+    Concurrent_List<T, Compare, Allocator>::~Concurrent_List()
+    {
+        Concurrent_Link* node = head_.next_.load(std::memory_order_relaxed);
+        while (node != &tail_)
+        {
+            Concurrent_Link* next = node->next_.load(std::memory_order_relaxed);
+            obj_destruct(node);
+            node = next;
+        }
+        free_batch(retired_);
+        free_batch(pending_);
+    }
+    //----------------------------------------------------------------------------------
+}
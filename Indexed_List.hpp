@@ -0,0 +1,587 @@
+#pragma once
+
+#include "List.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    struct Indexed_Link
+    {
+        Indexed_Link* next_;
+        Indexed_Link* prev_;
+    };
+
+    // A value node is threaded three times: on the doubly-linked chain for O(1) stepping, in a
+    // treap keyed by position, whose subtree sizes answer rank queries, and on the chain of
+    // nodes sharing its hash, so leaving the hash index never searches.
+    template<typename T>
+    struct Indexed_Node : Indexed_Link
+    {
+        Indexed_Node* left_;
+        Indexed_Node* right_;
+        Indexed_Node* parent_;
+        size_t size_;
+        uint32_t priority_;
+        size_t hash_;
+        Indexed_Node* hash_next_;
+        Indexed_Node* hash_prev_;
+        // built and destroyed by the list through its allocator
+        union { T data_; };
+
+        Indexed_Node()
+            : Indexed_Link{nullptr, nullptr}, left_(nullptr), right_(nullptr), parent_(nullptr),
+              size_(1), priority_(0), hash_(0), hash_next_(nullptr), hash_prev_(nullptr) {}
+        Indexed_Node(const Indexed_Node& node) = delete;
+        Indexed_Node& operator=(const Indexed_Node& node) = delete;
+        ~Indexed_Node() {}
+    };
+
+    //----------------------------------------------------------------------------------
+    // Elements are read-only through iterators: their cached hashes must stay valid.
+    template<typename T>
+    class Indexed_Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using pointer = const T*;
+        using reference = const T&;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        Indexed_Link* node_;
+
+        Indexed_Iterator(Indexed_Link* node) : node_(node) {}
+        Indexed_Iterator(const Indexed_Iterator& it) = default;
+        Indexed_Iterator& operator=(const Indexed_Iterator& it) = default;
+
+        reference operator*() const { return static_cast<Indexed_Node<T>*>(node_)->data_; }
+        pointer operator->() const { return &static_cast<Indexed_Node<T>*>(node_)->data_; }
+
+        Indexed_Iterator& operator++() {
+            node_ = node_->next_;
+            return *this;
+        }
+        Indexed_Iterator operator++(int) {
+            auto tmp = *this;
+            node_ = node_->next_;
+            return tmp;
+        }
+
+        Indexed_Iterator& operator--() {
+            node_ = node_->prev_;
+            return *this;
+        }
+        Indexed_Iterator operator--(int) {
+            auto tmp = *this;
+            node_ = node_->prev_;
+            return tmp;
+        }
+
+        bool operator==(const Indexed_Iterator& it) const { return node_ == it.node_; }
+        bool operator!=(const Indexed_Iterator& it) const { return node_ != it.node_; }
+    };
+
+    //----------------------------------------------------------------------------------
+    // List with an order-statistic treap over its nodes and a hash index on cached element
+    // hashes: at(i), index_of(it), insert and erase in O(log n) expected however many elements
+    // are equal, find(value) in O(log n) expected plus one rank query per equal candidate.
+    // Plain List is unaffected.
+    template<typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>, typename Allocator = std::allocator<T>>
+    class Indexed_List
+    {
+    private:
+        using Node = Indexed_Node<T>;
+        using Node_Alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using Node_Traits = std::allocator_traits<Node_Alloc>;
+
+    public:
+        using iterator = Indexed_Iterator<T>;
+        using const_iterator = Indexed_Iterator<T>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        Indexed_Link fake_node_;
+        Node* root_;
+        Node_Alloc node_alloc_;
+        size_t sz_;
+        uint32_t seed_;
+
+        // first node of each equal-hash chain
+        std::unordered_map<size_t, Node*> hash_index_;
+        Hash hash_;
+        KeyEqual equal_;
+
+    public:
+        Indexed_List() : Indexed_List(Allocator()) {}
+        explicit Indexed_List(const Allocator& alloc);
+        Indexed_List(std::initializer_list<T> init);
+
+        Indexed_List(const Indexed_List& copy_list);
+        Indexed_List(Indexed_List&& move_list);
+        Indexed_List& operator=(const Indexed_List& copy_list);
+        Indexed_List& operator=(Indexed_List&& move_list);
+
+        size_t size() const { return sz_; }
+        bool empty() const { return !sz_; }
+        void clear();
+
+        const T& front() const { return *begin(); }
+        const T& back() const { return *(--end()); }
+
+        const T& operator[](size_t i) const { return nth_node(i)->data_; }
+        const T& at(size_t i) const;
+        const_iterator nth(size_t i) const { return i < sz_ ? const_iterator(nth_node(i)) : end(); }
+        size_t index_of(const_iterator it) const;
+        const_iterator find(const T& el) const;
+
+        template<typename U = T>
+        void push_front(U&& el) { emplace(begin(), std::forward<U>(el)); }
+        template<typename U = T>
+        void push_back(U&& el) { emplace(end(), std::forward<U>(el)); }
+
+        void pop_front() { erase(begin()); }
+        void pop_back() { erase(--end()); }
+
+        template<typename U = T>
+        iterator insert(const_iterator it, U&& el) { return emplace(it, std::forward<U>(el)); }
+        template<typename... Args>
+        iterator emplace(const_iterator it, Args&&... args);
+        iterator erase(const_iterator it);
+
+        void swap(Indexed_List& other);
+
+        const_iterator begin() const { return {fake_node_.next_}; }
+        const_iterator end() const { return {const_cast<Indexed_Link*>(&fake_node_)}; }
+
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        const_reverse_iterator crbegin() const { return rbegin(); }
+        const_reverse_iterator crend() const { return rend(); }
+
+    private:
+        static size_t subtree_size(const Node* node) { return node ? node->size_ : 0; }
+        static void update_size(Node* node) { node->size_ = 1 + subtree_size(node->left_) + subtree_size(node->right_); }
+
+        uint32_t next_priority();
+        Node* nth_node(size_t i) const;
+        void rotate_up(Node* node);
+        void tree_insert_before(Node* pos, Node* new_node);
+        void tree_erase(Node* del_node);
+        void index_insert(Node* new_node);
+        void index_erase(Node* del_node);
+
+        void take_nodes(Indexed_List& other) noexcept;
+        void move_elements(Indexed_List& other);
+        void obj_destruct(Node* del_node);
+
+    public:
+        ~Indexed_List();
+    };
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>::Indexed_List(const Allocator& alloc)
+        : fake_node_{&fake_node_, &fake_node_}, root_(nullptr), node_alloc_(alloc), sz_(0), seed_(0x9e3779b9u),
+          hash_index_(), hash_(), equal_() {}
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>::Indexed_List(std::initializer_list<T> init) : Indexed_List()
+    {
+        for (const T& el : init)
+        {
+            push_back(el);
+        }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>::Indexed_List(const Indexed_List& copy_list)
+        : Indexed_List(Allocator(Node_Traits::select_on_container_copy_construction(copy_list.node_alloc_)))
+    {
+        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
+        {
+            push_back(*it);
+        }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>::Indexed_List(Indexed_List&& move_list)
+        : fake_node_{&fake_node_, &fake_node_}, root_(nullptr), node_alloc_(std::move(move_list.node_alloc_)), sz_(0),
+          seed_(0x9e3779b9u), hash_index_(), hash_(), equal_()
+    {
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            take_nodes(move_list);
+        } else {
+            if(node_alloc_ == move_list.node_alloc_) {
+                take_nodes(move_list);
+            } else {
+                move_elements(move_list);
+            }
+        }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>& Indexed_List<T, Hash, KeyEqual, Allocator>::operator=(const Indexed_List& copy_list)
+    {
+        if(this == &copy_list) { return *this; }
+        if constexpr (Node_Traits::propagate_on_container_copy_assignment::value) {
+            if(node_alloc_ != copy_list.node_alloc_)
+            {
+                clear();
+                node_alloc_ = copy_list.node_alloc_;
+            }
+        }
+        // built with this list's allocator, so the swap below only relinks
+        Indexed_List tmp((Allocator(node_alloc_)));
+        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
+        {
+            tmp.push_back(*it);
+        }
+        swap(tmp);
+        return *this;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>& Indexed_List<T, Hash, KeyEqual, Allocator>::operator=(Indexed_List&& move_list)
+    {
+        if(this == &move_list) { return *this; }
+        clear();
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            node_alloc_ = std::move(move_list.node_alloc_);
+        } else {
+            if(node_alloc_ != move_list.node_alloc_)
+            {
+                move_elements(move_list);
+                return *this;
+            }
+        }
+        take_nodes(move_list);
+        return *this;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::clear()
+    {
+        Indexed_Link* link = fake_node_.next_;
+        while (link != &fake_node_)
+        {
+            Node* del_node = static_cast<Node*>(link);
+            link = link->next_;
+            obj_destruct(del_node);
+        }
+        fake_node_.next_ = &fake_node_;
+        fake_node_.prev_ = &fake_node_;
+        root_ = nullptr;
+        hash_index_.clear();
+        sz_ = 0;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    const T& Indexed_List<T, Hash, KeyEqual, Allocator>::at(size_t i) const
+    {
+        if(i >= sz_) { throw std::out_of_range("Indexed_List::at"); }
+        return nth_node(i)->data_;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    size_t Indexed_List<T, Hash, KeyEqual, Allocator>::index_of(const_iterator it) const
+    {
+        if(it.node_ == &fake_node_) { return sz_; }
+
+        Node* node = static_cast<Node*>(it.node_);
+        size_t idx = subtree_size(node->left_);
+        for (; node->parent_; node = node->parent_)
+        {
+            if(node == node->parent_->right_) { idx += subtree_size(node->parent_->left_) + 1; }
+        }
+        return idx;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    typename Indexed_List<T, Hash, KeyEqual, Allocator>::const_iterator Indexed_List<T, Hash, KeyEqual, Allocator>::find(const T& el) const
+    {
+        Node* found = nullptr;
+        size_t found_idx = sz_;
+        auto chain = hash_index_.find(hash_(el));
+        if(chain == hash_index_.end()) { return end(); }
+        for (Node* node = chain->second; node; node = node->hash_next_)
+        {
+            if(!equal_(node->data_, el)) { continue; }
+            size_t idx = index_of(const_iterator(node));
+            if(idx < found_idx)
+            {
+                found = node;
+                found_idx = idx;
+            }
+        }
+        return found ? const_iterator(found) : end();
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    template<typename... Args>
+    typename Indexed_List<T, Hash, KeyEqual, Allocator>::iterator Indexed_List<T, Hash, KeyEqual, Allocator>::emplace(const_iterator it, Args&&... args)
+    {
+        Node* new_node = Node_Traits::allocate(node_alloc_, 1);
+        Node_Traits::construct(node_alloc_, new_node);
+        try {
+            Node_Traits::construct(node_alloc_, std::addressof(new_node->data_), std::forward<Args>(args)...);
+        } catch(...) {
+            Node_Traits::deallocate(node_alloc_, new_node, 1);
+            throw;
+        }
+        try {
+            new_node->hash_ = hash_(new_node->data_);
+            index_insert(new_node);
+        } catch(...) {
+            obj_destruct(new_node);
+            throw;
+        }
+
+        new_node->priority_ = next_priority();
+        Node* pos = it.node_ == &fake_node_ ? nullptr : static_cast<Node*>(it.node_);
+        tree_insert_before(pos, new_node);
+        link_before(it.node_, static_cast<Indexed_Link*>(new_node));
+        ++sz_;
+        return iterator(new_node);
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    typename Indexed_List<T, Hash, KeyEqual, Allocator>::iterator Indexed_List<T, Hash, KeyEqual, Allocator>::erase(const_iterator it)
+    {
+        Node* del_node = static_cast<Node*>(it.node_);
+        Indexed_Link* next = del_node->next_;
+
+        index_erase(del_node);
+        tree_erase(del_node);
+        unlink_node(static_cast<Indexed_Link*>(del_node));
+        obj_destruct(del_node);
+        --sz_;
+        return iterator(next);
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::swap(Indexed_List& other)
+    {
+        if(this == &other) { return; }
+        if constexpr (!Node_Traits::propagate_on_container_swap::value) {
+            // nodes cannot change allocator, so unequal allocators stay put and the elements move
+            if(node_alloc_ != other.node_alloc_)
+            {
+                Indexed_List tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+                return;
+            }
+        }
+
+        std::swap(fake_node_, other.fake_node_);
+        std::swap(root_, other.root_);
+        if constexpr (Node_Traits::propagate_on_container_swap::value) {
+            std::swap(node_alloc_, other.node_alloc_);
+        }
+        std::swap(sz_, other.sz_);
+        std::swap(seed_, other.seed_);
+        hash_index_.swap(other.hash_index_);
+        std::swap(hash_, other.hash_);
+        std::swap(equal_, other.equal_);
+
+        for (Indexed_List* list : {this, &other})
+        {
+            Indexed_Link* fake = &list->fake_node_;
+            if(list->empty()) {
+                fake->next_ = fake;
+                fake->prev_ = fake;
+            } else {
+                fake->next_->prev_ = fake;
+                fake->prev_->next_ = fake;
+            }
+        }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    uint32_t Indexed_List<T, Hash, KeyEqual, Allocator>::next_priority()
+    {
+        // xorshift32: treap balance only needs cheap, well-spread priorities
+        seed_ ^= seed_ << 13;
+        seed_ ^= seed_ >> 17;
+        seed_ ^= seed_ << 5;
+        return seed_;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    typename Indexed_List<T, Hash, KeyEqual, Allocator>::Node* Indexed_List<T, Hash, KeyEqual, Allocator>::nth_node(size_t i) const
+    {
+        Node* node = root_;
+        while (true)
+        {
+            size_t left = subtree_size(node->left_);
+            if(i < left) {
+                node = node->left_;
+            } else if(i == left) {
+                return node;
+            } else {
+                i -= left + 1;
+                node = node->right_;
+            }
+        }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::rotate_up(Node* node)
+    {
+        Node* parent = node->parent_;
+        Node* grand = parent->parent_;
+        if(node == parent->left_) {
+            parent->left_ = node->right_;
+            if(node->right_) { node->right_->parent_ = parent; }
+            node->right_ = parent;
+        } else {
+            parent->right_ = node->left_;
+            if(node->left_) { node->left_->parent_ = parent; }
+            node->left_ = parent;
+        }
+        parent->parent_ = node;
+        node->parent_ = grand;
+
+        if(!grand) {
+            root_ = node;
+        } else if(grand->left_ == parent) {
+            grand->left_ = node;
+        } else {
+            grand->right_ = node;
+        }
+        update_size(parent);
+        update_size(node);
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::tree_insert_before(Node* pos, Node* new_node)
+    {
+        // hang new_node as the in-order predecessor of pos (pos == nullptr means end)
+        if(!root_) {
+            root_ = new_node;
+            return;
+        }
+
+        Node* parent = nullptr;
+        if(pos && !pos->left_) {
+            pos->left_ = new_node;
+            parent = pos;
+        } else {
+            parent = pos ? pos->left_ : root_;
+            while (parent->right_) { parent = parent->right_; }
+            parent->right_ = new_node;
+        }
+        new_node->parent_ = parent;
+
+        for (Node* node = parent; node; node = node->parent_) { ++node->size_; }
+        while (new_node->parent_ && new_node->priority_ > new_node->parent_->priority_)
+        {
+            rotate_up(new_node);
+        }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::tree_erase(Node* del_node)
+    {
+        while (del_node->left_ || del_node->right_)
+        {
+            Node* child = del_node->left_;
+            if(!child || (del_node->right_ && del_node->right_->priority_ > child->priority_)) { child = del_node->right_; }
+            rotate_up(child);
+        }
+
+        Node* parent = del_node->parent_;
+        if(!parent) {
+            root_ = nullptr;
+        } else if(parent->left_ == del_node) {
+            parent->left_ = nullptr;
+        } else {
+            parent->right_ = nullptr;
+        }
+        for (Node* node = parent; node; node = node->parent_) { --node->size_; }
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::index_insert(Node* new_node)
+    {
+        auto [head, inserted] = hash_index_.try_emplace(new_node->hash_, new_node);
+        if(inserted) { return; }
+        new_node->hash_next_ = head->second;
+        head->second->hash_prev_ = new_node;
+        head->second = new_node;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::index_erase(Node* del_node)
+    {
+        Node* next = del_node->hash_next_;
+        Node* prev = del_node->hash_prev_;
+        if(next) { next->hash_prev_ = prev; }
+        if(prev) {
+            prev->hash_next_ = next;
+        } else if(next) {
+            hash_index_.find(del_node->hash_)->second = next;
+        } else {
+            hash_index_.erase(del_node->hash_);
+        }
+        del_node->hash_next_ = del_node->hash_prev_ = nullptr;
+    }
+
+    // Takes every node of other into this empty list.
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::take_nodes(Indexed_List& other) noexcept
+    {
+        hash_ = other.hash_;
+        equal_ = other.equal_;
+        if(other.empty()) { return; }
+        fake_node_ = other.fake_node_;
+        fake_node_.next_->prev_ = &fake_node_;
+        fake_node_.prev_->next_ = &fake_node_;
+        root_ = std::exchange(other.root_, nullptr);
+        sz_ = std::exchange(other.sz_, 0);
+        hash_index_.swap(other.hash_index_);
+
+        other.fake_node_.next_ = &other.fake_node_;
+        other.fake_node_.prev_ = &other.fake_node_;
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::move_elements(Indexed_List& other)
+    {
+        hash_ = other.hash_;
+        equal_ = other.equal_;
+        for (Indexed_Link* link = other.fake_node_.next_; link != &other.fake_node_; link = link->next_)
+        {
+            push_back(std::move(static_cast<Node*>(link)->data_));
+        }
+        other.clear();
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    void Indexed_List<T, Hash, KeyEqual, Allocator>::obj_destruct(Node* del_node)
+    {
+        Node_Traits::destroy(node_alloc_, std::addressof(del_node->data_));
+        Node_Traits::deallocate(node_alloc_, del_node, 1);
+    }
+
+    template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+    Indexed_List<T, Hash, KeyEqual, Allocator>::~Indexed_List()
+    {
+        clear();
+    }
+    //----------------------------------------------------------------------------------
+}
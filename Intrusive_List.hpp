@@ -0,0 +1,266 @@
+#pragma once
+
+#include "List.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Embedded links for Intrusive_List. An object may carry several hooks to sit on several
+    // lists at once. Copying an object never copies its links; a hook must be unlinked from
+    // its list before the owning object is destroyed.
+    struct List_Hook
+    {
+        List_Hook* next_;
+        List_Hook* prev_;
+
+        List_Hook() : next_(nullptr), prev_(nullptr) {}
+        List_Hook(const List_Hook&) : List_Hook() {}
+        List_Hook& operator=(const List_Hook&) { return *this; }
+        ~List_Hook() = default;
+
+        bool is_linked() const { return next_ != nullptr; }
+    };
+
+    template<typename T, List_Hook T::*Hook>
+    struct Hook_Traits
+    {
+        static List_Hook* to_hook(T& obj) { return &(obj.*Hook); }
+
+        static T* to_owner(List_Hook* hook)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) - offset());
+        }
+
+        // Both the Itanium and the MSVC ABI store a data member pointer as the member's byte
+        // offset, so reading its bits needs no object; Hook is a constant, so this folds away.
+        static std::ptrdiff_t offset() noexcept
+        {
+            static_assert(sizeof(Hook) == sizeof(std::ptrdiff_t), "unexpected data member pointer layout");
+            std::ptrdiff_t offset = 0;
+            List_Hook T::*hook = Hook;
+            std::memcpy(&offset, &hook, sizeof(offset));
+            return offset;
+        }
+    };
+
+    //----------------------------------------------------------------------------------
+    template<typename T, List_Hook T::*Hook, bool IsConst>
+    class Intrusive_Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        List_Hook* node_;
+
+        Intrusive_Iterator(List_Hook* node) : node_(node) {}
+        Intrusive_Iterator(const Intrusive_Iterator& it) = default;
+        Intrusive_Iterator& operator=(const Intrusive_Iterator& it) = default;
+        template<bool C = IsConst, typename = std::enable_if_t<C>>
+        Intrusive_Iterator(const Intrusive_Iterator<T, Hook, false>& it) : node_(it.node_) {}
+
+        reference operator*() const { return *Hook_Traits<T, Hook>::to_owner(node_); }
+        pointer operator->() const { return Hook_Traits<T, Hook>::to_owner(node_); }
+
+        Intrusive_Iterator& operator++() {
+            node_ = node_->next_;
+            return *this;
+        }
+        Intrusive_Iterator operator++(int) {
+            auto tmp = *this;
+            node_ = node_->next_;
+            return tmp;
+        }
+
+        Intrusive_Iterator& operator--() {
+            node_ = node_->prev_;
+            return *this;
+        }
+        Intrusive_Iterator operator--(int) {
+            auto tmp = *this;
+            node_ = node_->prev_;
+            return tmp;
+        }
+
+        bool operator==(const Intrusive_Iterator& it) const { return node_ == it.node_; }
+        bool operator!=(const Intrusive_Iterator& it) const { return node_ != it.node_; }
+    };
+
+    //----------------------------------------------------------------------------------
+    // Threads caller-owned objects through their List_Hook member: no allocation, no copies,
+    // O(1) unlink from the object itself. The list never owns or destroys its elements.
+    template<typename T, List_Hook T::*Hook>
+    class Intrusive_List
+    {
+    private:
+        using Traits = Hook_Traits<T, Hook>;
+
+    public:
+        using iterator = Intrusive_Iterator<T, Hook, false>;
+        using const_iterator = Intrusive_Iterator<T, Hook, true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        List_Hook fake_node_;
+        size_t sz_;
+
+    public:
+        Intrusive_List();
+
+        Intrusive_List(const Intrusive_List& copy_list) = delete;
+        Intrusive_List(Intrusive_List&& move_list);
+        Intrusive_List& operator=(const Intrusive_List& copy_list) = delete;
+        Intrusive_List& operator=(Intrusive_List&& move_list);
+
+        size_t size() const { return sz_; }
+        bool empty() const { return !sz_; }
+        void clear();
+
+        T& front() { return *begin(); }
+        const T& front() const { return *begin(); }
+
+        T& back() { return *(--end()); }
+        const T& back() const { return *(--end()); }
+
+        void push_front(T& obj) { insert(begin(), obj); }
+        void push_back(T& obj) { insert(end(), obj); }
+
+        void pop_front() { unlink(front()); }
+        void pop_back() { unlink(back()); }
+
+        iterator insert(const_iterator it, T& obj);
+        iterator erase(const_iterator it);
+        void unlink(T& obj);
+
+        void swap(Intrusive_List& other);
+
+        static iterator iterator_to(T& obj) { return {Traits::to_hook(obj)}; }
+        static const_iterator iterator_to(const T& obj) { return {Traits::to_hook(const_cast<T&>(obj))}; }
+
+        iterator begin() { return {fake_node_.next_}; }
+        iterator end() { return {&fake_node_}; }
+
+        const_iterator begin() const { return {fake_node_.next_}; }
+        const_iterator end() const { return {const_cast<List_Hook*>(&fake_node_)}; }
+
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        const_reverse_iterator crbegin() const { return rbegin(); }
+        const_reverse_iterator crend() const { return rend(); }
+
+    public:
+        ~Intrusive_List();
+    };
+
+    template<typename T, List_Hook T::*Hook>
+    Intrusive_List<T, Hook>::Intrusive_List() : fake_node_(), sz_(0)
+    {
+        fake_node_.next_ = &fake_node_;
+        fake_node_.prev_ = &fake_node_;
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    Intrusive_List<T, Hook>::Intrusive_List(Intrusive_List&& move_list) : Intrusive_List()
+    {
+        swap(move_list);
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    Intrusive_List<T, Hook>& Intrusive_List<T, Hook>::operator=(Intrusive_List&& move_list)
+    {
+        if(this != &move_list)
+        {
+            clear();
+            swap(move_list);
+        }
+        return *this;
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    void Intrusive_List<T, Hook>::clear()
+    {
+        List_Hook* node = fake_node_.next_;
+        while (node != &fake_node_)
+        {
+            List_Hook* next = node->next_;
+            node->next_ = nullptr;
+            node->prev_ = nullptr;
+            node = next;
+        }
+        fake_node_.next_ = &fake_node_;
+        fake_node_.prev_ = &fake_node_;
+        sz_ = 0;
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    typename Intrusive_List<T, Hook>::iterator Intrusive_List<T, Hook>::insert(const_iterator it, T& obj)
+    {
+        List_Hook* new_node = Traits::to_hook(obj);
+        link_before(it.node_, new_node);
+        ++sz_;
+        return iterator(new_node);
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    typename Intrusive_List<T, Hook>::iterator Intrusive_List<T, Hook>::erase(const_iterator it)
+    {
+        List_Hook* next = it.node_->next_;
+        unlink(*Traits::to_owner(it.node_));
+        return iterator(next);
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    void Intrusive_List<T, Hook>::unlink(T& obj)
+    {
+        List_Hook* del_node = Traits::to_hook(obj);
+        unlink_node(del_node);
+        del_node->next_ = nullptr;
+        del_node->prev_ = nullptr;
+        --sz_;
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    void Intrusive_List<T, Hook>::swap(Intrusive_List& other)
+    {
+        if(this == &other) { return; }
+        std::swap(fake_node_.next_, other.fake_node_.next_);
+        std::swap(fake_node_.prev_, other.fake_node_.prev_);
+        std::swap(sz_, other.sz_);
+
+        for (Intrusive_List* list : {this, &other})
+        {
+            List_Hook* fake = &list->fake_node_;
+            if(list->empty()) {
+                fake->next_ = fake;
+                fake->prev_ = fake;
+            } else {
+                fake->next_->prev_ = fake;
+                fake->prev_->next_ = fake;
+            }
+        }
+    }
+
+    template<typename T, List_Hook T::*Hook>
+    Intrusive_List<T, Hook>::~Intrusive_List()
+    {
+        clear();
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -1,97 +1,390 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
 #include <exception>
+#include <future>
+#include <initializer_list>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
 
 namespace mls
 {    
     //----------------------------------------------------------------------------------
+    // Allocators exposing release() (Pool_Allocator, Arena_Allocator) can drop all their nodes at once.
+    template<typename Alloc, typename = void>
+    struct has_bulk_release : std::false_type {};
+
+    template<typename Alloc>
+    struct has_bulk_release<Alloc, std::void_t<decltype(std::declval<Alloc&>().release())>> : std::true_type {};
+
+    // Allocators exposing reserved_bytes() can tell List::compact() how much memory it gave back.
+    template<typename Alloc, typename = void>
+    struct has_reserved_bytes : std::false_type {};
+
+    template<typename Alloc>
+    struct has_reserved_bytes<Alloc, std::void_t<decltype(std::declval<const Alloc&>().reserved_bytes())>> : std::true_type {};
+
+    //----------------------------------------------------------------------------------
+    // Link primitives shared by every sentinel-based chain (List, Intrusive_List).
+    template<typename Node>
+    void link_before(Node* old_node, Node* new_node)
+    {
+        new_node->next_ = old_node;
+        new_node->prev_ = old_node->prev_;
+        old_node->prev_->next_ = new_node;
+        old_node->prev_ = new_node;
+    }
+
+    template<typename Node>
+    void unlink_node(Node* del_node)
+    {
+        del_node->prev_->next_ = del_node->next_;
+        del_node->next_->prev_ = del_node->prev_;
+    }
+
+    //----------------------------------------------------------------------------------
+    // The sentinel is a bare link, so an empty List never constructs a T.
+    struct List_Link
+    {
+        List_Link* next_;
+        List_Link* prev_;
+    };
+
     template<typename T>
-    struct List_Node
+    struct List_Node : List_Link
     {
-        T data_;
-        List_Node* next_;
-        List_Node* prev_;
+        // the payload is built and destroyed apart from the node, so the allocator sees T itself
+        union { T data_; };
 
-        List_Node() = default;
-        template<typename U = T>
-        explicit List_Node(U&& el) : data_(el), next_(nullptr), prev_(nullptr){}
+        List_Node() : List_Link{nullptr, nullptr} {}
         List_Node(const List_Node& node) = delete;
         List_Node& operator=(const List_Node& node) = delete;
-        ~List_Node() = default;
+        ~List_Node() {}
     };
 
     //----------------------------------------------------------------------------------
+    // A full bidirectional iterator in the C++20 sense too: default constructible, const
+    // dereference and comparison, by-value post-increment, and iterator -> const_iterator
+    // conversion with mixed comparisons, so List models std::ranges::bidirectional_range.
     template<typename T, bool IsConst>
     class List_Base_Iterator {
     public:
         using iterator_category = std::bidirectional_iterator_tag;
-        using pointer = std::conditional_t<IsConst, const List_Node<T>*, List_Node<T>*>;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
         using reference = std::conditional_t<IsConst, const T&, T&>;
         using value_type = T;
         using difference_type = std::ptrdiff_t;
+        using link_pointer = std::conditional_t<IsConst, const List_Link*, List_Link*>;
+        using node_pointer = std::conditional_t<IsConst, const List_Node<T>*, List_Node<T>*>;
 
-        pointer node_;
+        link_pointer node_;
 
-        List_Base_Iterator(pointer node) : node_(node) {}
+        List_Base_Iterator() noexcept : node_(nullptr) {}
+        List_Base_Iterator(link_pointer node) noexcept : node_(node) {}
         List_Base_Iterator(const List_Base_Iterator& it) = default;
+        template<bool C = IsConst, typename = std::enable_if_t<C>>
+        List_Base_Iterator(const List_Base_Iterator<T, false>& it) noexcept : node_(it.node_) {}
         List_Base_Iterator& operator=(const List_Base_Iterator& it) = default;
 
-        reference operator*() { return node_->data_; }
-        pointer operator->() { return node_; }
+        reference operator*() const { return static_cast<node_pointer>(node_)->data_; }
+        pointer operator->() const { return &static_cast<node_pointer>(node_)->data_; }
 
-        List_Base_Iterator& operator++() { 
-            node_ = node_->next_; 
+        List_Base_Iterator& operator++() {
+            node_ = node_->next_;
             return *this;
         }
-        List_Base_Iterator& operator++(int) { 
+        List_Base_Iterator operator++(int) {
             auto tmp = *this;
             node_ = node_->next_;
-            return tmp; 
+            return tmp;
         }
 
-        List_Base_Iterator& operator--() { 
-            node_ = node_->prev_; 
-            return *this; 
+        List_Base_Iterator& operator--() {
+            node_ = node_->prev_;
+            return *this;
         }
-        List_Base_Iterator& operator--(int) { 
-            auto tmp = this;
+        List_Base_Iterator operator--(int) {
+            auto tmp = *this;
             node_ = node_->prev_;
-            return tmp; 
+            return tmp;
         }
 
-        bool operator==(const List_Base_Iterator& it) { return node_ == it.node_; }
-        bool operator!=(const List_Base_Iterator& it) { return node_ != it.node_; }
+        // hidden friends, so an iterator converts for comparison against a const_iterator
+        friend bool operator==(const List_Base_Iterator& a, const List_Base_Iterator& b) { return a.node_ == b.node_; }
+        friend bool operator!=(const List_Base_Iterator& a, const List_Base_Iterator& b) { return a.node_ != b.node_; }
     };
     
     //----------------------------------------------------------------------------------
-    template<typename T, typename Allocator = std::allocator<T>>
-    class List
+    // Outstanding handles of a list whose allocator can release() everything at once, and the
+    // allocator they give their nodes back to. The list keeps it on the heap and passes it on
+    // together with the allocator, so the handles follow their slabs into a moved-to list.
+    template<typename Node_Alloc>
+    struct List_Extract_State
     {
+        Node_Alloc* alloc_;
+        size_t extracted_;
+    };
+
+    // Owns a node unlinked by List::extract. The node is still tied to the allocator it came
+    // from, so a handle must be reinserted or destroyed before the list holding that allocator
+    // dies or is move-assigned over; moving or swapping the source list is fine. While a handle
+    // is out, a list whose allocator supports release() frees nodes one by one in clear() and
+    // repacks in place in rehome() and compact(), so the handle's slab is never given back.
+    template<typename T, typename Node_Alloc>
+    class List_Node_Handle
+    {
+        template<typename, typename, typename>
+        friend class List;
+
     private:
-        using Node_Alloc = typename Allocator::template rebind<List_Node<T>>::other;
+        List_Node<T>* node_;
+        Node_Alloc* alloc_;
+        // set instead of alloc_ when the source list counts its handles
+        List_Extract_State<Node_Alloc>* state_;
 
+        List_Node_Handle(List_Node<T>* node, Node_Alloc* alloc, List_Extract_State<Node_Alloc>* state) noexcept
+            : node_(node), alloc_(state ? nullptr : alloc), state_(state) {}
+
+    public:
+        List_Node_Handle() noexcept : node_(nullptr), alloc_(nullptr), state_(nullptr) {}
+        List_Node_Handle(const List_Node_Handle& handle) = delete;
+        List_Node_Handle& operator=(const List_Node_Handle& handle) = delete;
+        List_Node_Handle(List_Node_Handle&& handle) noexcept
+            : node_(std::exchange(handle.node_, nullptr)), alloc_(std::exchange(handle.alloc_, nullptr)),
+              state_(std::exchange(handle.state_, nullptr)) {}
+        List_Node_Handle& operator=(List_Node_Handle&& handle) noexcept;
+
+        bool empty() const noexcept { return !node_; }
+        explicit operator bool() const noexcept { return node_; }
+
+        T& value() const { return node_->data_; }
+
+        void swap(List_Node_Handle& handle) noexcept;
+
+        ~List_Node_Handle() { reset(); }
+
+    private:
+        Node_Alloc& allocator() const noexcept { return state_ ? *state_->alloc_ : *alloc_; }
+        void reset() noexcept;
+        List_Node<T>* release() noexcept;
+    };
+
+    template<typename T, typename Node_Alloc>
+    List_Node_Handle<T, Node_Alloc>& List_Node_Handle<T, Node_Alloc>::operator=(List_Node_Handle&& handle) noexcept
+    {
+        if(this != &handle)
+        {
+            reset();
+            node_ = std::exchange(handle.node_, nullptr);
+            alloc_ = std::exchange(handle.alloc_, nullptr);
+            state_ = std::exchange(handle.state_, nullptr);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Node_Alloc>
+    void List_Node_Handle<T, Node_Alloc>::swap(List_Node_Handle& handle) noexcept
+    {
+        std::swap(node_, handle.node_);
+        std::swap(alloc_, handle.alloc_);
+        std::swap(state_, handle.state_);
+    }
+
+    template<typename T, typename Node_Alloc>
+    void List_Node_Handle<T, Node_Alloc>::reset() noexcept
+    {
+        if(!node_) { return; }
+        std::allocator_traits<Node_Alloc>::destroy(allocator(), std::addressof(node_->data_));
+        std::allocator_traits<Node_Alloc>::deallocate(allocator(), node_, 1);
+        release();
+    }
+
+    // Gives up the node without freeing it.
+    template<typename T, typename Node_Alloc>
+    List_Node<T>* List_Node_Handle<T, Node_Alloc>::release() noexcept
+    {
+        if(state_) { --state_->extracted_; }
+        alloc_ = nullptr;
+        state_ = nullptr;
+        return std::exchange(node_, nullptr);
+    }
+
+    //----------------------------------------------------------------------------------
+    template<typename T, typename Allocator>
+    using List_Node_Alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<List_Node<T>>;
+
+    // Handles extracted and not yet reinserted or destroyed. Only lists whose allocator can
+    // release() everything at once keep the count; for the rest it is an empty base.
+    template<bool Counted, typename Node_Alloc>
+    struct List_Extract_Count
+    {
+        List_Extract_State<Node_Alloc>* extract_state(Node_Alloc&) noexcept { return nullptr; }
+        bool has_extracted() const noexcept { return false; }
+        void swap_extracted(List_Extract_Count&, Node_Alloc&, Node_Alloc&) noexcept {}
+    };
+
+    template<typename Node_Alloc>
+    struct List_Extract_Count<true, Node_Alloc>
+    {
+        List_Extract_State<Node_Alloc>* state_ = nullptr;
+
+        List_Extract_Count() = default;
+        List_Extract_Count(const List_Extract_Count&) = delete;
+        List_Extract_Count& operator=(const List_Extract_Count&) = delete;
+        ~List_Extract_Count() { delete state_; }
+
+        List_Extract_State<Node_Alloc>* extract_state(Node_Alloc& alloc)
+        {
+            if(!state_) { state_ = new List_Extract_State<Node_Alloc>{&alloc, 0}; }
+            return state_;
+        }
+        bool has_extracted() const noexcept { return state_ && state_->extracted_; }
+
+        // Called after the two lists exchanged allocators: each count goes where its allocator went.
+        void swap_extracted(List_Extract_Count& other, Node_Alloc& alloc, Node_Alloc& other_alloc) noexcept
+        {
+            std::swap(state_, other.state_);
+            if(state_) { state_->alloc_ = &alloc; }
+            if(other.state_) { other.state_->alloc_ = &other_alloc; }
+        }
+    };
+
+    //----------------------------------------------------------------------------------
+    // Counters a List exposes through stats(); every field stays 0 with No_List_Stats.
+    struct List_Stats
+    {
+        size_t constructs_;
+        size_t destructs_;
+        size_t bytes_allocated_;
+        size_t bytes_freed_;
+        size_t peak_size_;
+        size_t sorts_;
+        size_t comparisons_;
+        size_t splices_;
+        size_t merges_;
+    };
+
+    // Stats policies are the last List template argument. List derives from the policy
+    // privately, so the empty default costs no space and its hooks inline to nothing.
+    // A custom policy provides the same members; `enabled` controls comparison counting.
+    struct No_List_Stats
+    {
+        static constexpr bool enabled = false;
+
+        void on_construct(size_t, size_t) noexcept {}
+        void on_destruct(size_t, size_t) noexcept {}
+        void on_size(size_t) noexcept {}
+        void on_sort(size_t) noexcept {}
+        void on_splice() noexcept {}
+        void on_merge() noexcept {}
+
+        List_Stats snapshot() const noexcept { return {}; }
+        void reset() noexcept {}
+    };
+
+    // Plain counters owned by one List: not shared with copies or moved-to lists and not
+    // synchronized, so read them from the thread that owns the list.
+    class Counting_List_Stats
+    {
+    private:
+        List_Stats stats_ = {};
+
+    public:
+        static constexpr bool enabled = true;
+
+        void on_construct(size_t count, size_t bytes) noexcept
+        {
+            stats_.constructs_ += count;
+            stats_.bytes_allocated_ += bytes;
+        }
+        void on_destruct(size_t count, size_t bytes) noexcept
+        {
+            stats_.destructs_ += count;
+            stats_.bytes_freed_ += bytes;
+        }
+        void on_size(size_t size) noexcept { stats_.peak_size_ = std::max(stats_.peak_size_, size); }
+        void on_sort(size_t comparisons) noexcept
+        {
+            ++stats_.sorts_;
+            stats_.comparisons_ += comparisons;
+        }
+        void on_splice() noexcept { ++stats_.splices_; }
+        void on_merge() noexcept { ++stats_.merges_; }
+
+        List_Stats snapshot() const noexcept { return stats_; }
+        void reset() noexcept { stats_ = {}; }
+    };
+
+    template<typename T, typename Allocator, typename Stats>
+    class List_Compaction;
+
+    //----------------------------------------------------------------------------------
+    template<typename T, typename Allocator = std::allocator<T>, typename Stats = No_List_Stats>
+    class List : private Stats, private List_Extract_Count<has_bulk_release<List_Node_Alloc<T, Allocator>>::value, List_Node_Alloc<T, Allocator>>
+    {
+        template<typename, typename, typename>
+        friend class List_Compaction;
+
+    private:
+        using Node_Alloc = List_Node_Alloc<T, Allocator>;
+        using Node_Traits = std::allocator_traits<Node_Alloc>;
+
+        // moves and swap only relink when the allocator travels with its nodes or all instances
+        // are interchangeable; otherwise they may have to move elements one by one
+        static constexpr bool nothrow_move_ = Node_Traits::propagate_on_container_move_assignment::value
+            || Node_Traits::is_always_equal::value;
+        static constexpr bool nothrow_swap_ = Node_Traits::propagate_on_container_swap::value
+            || Node_Traits::is_always_equal::value;
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
         using iterator = List_Base_Iterator<T, false>;
         using const_iterator = List_Base_Iterator<T, true>;
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using node_type = List_Node_Handle<T, Node_Alloc>;
+        using compaction_type = List_Compaction<T, Allocator, Stats>;
 
     private:
-        List_Node<T> fake_node_;
+        List_Link fake_node_;
         Node_Alloc node_alloc_;
         size_t sz_;
 
     public:
-        List();
+        List() : List(Allocator()) {}
+        explicit List(const Allocator& alloc);
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        List(InputIt first, InputIt last, const Allocator& alloc = Allocator()) : List(alloc) { insert(end(), first, last); }
+        List(std::initializer_list<T> init, const Allocator& alloc = Allocator()) : List(init.begin(), init.end(), alloc) {}
 
         List(const List& copy_list);
-        List(List&& move_list);
+        List(const List& copy_list, const Allocator& alloc) : List(copy_list.begin(), copy_list.end(), alloc) {}
+        List(List&& move_list) noexcept(nothrow_move_);
+        List(List&& move_list, const Allocator& alloc);
         List& operator=(const List& copy_list);
-        List& operator=(List&& move_list);
+        List& operator=(List&& move_list) noexcept(nothrow_move_);
+        List& operator=(std::initializer_list<T> init);
+
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        void assign(InputIt first, InputIt last);
+        void assign(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+
+        allocator_type get_allocator() const { return allocator_type(node_alloc_); }
 
         size_t size() const { return sz_; }
         bool empty() const { return !sz_; }
-        void clear();
+        void clear() noexcept;
 
         T& front() { return *begin(); }
         const T& front() const { return *begin(); }
@@ -100,23 +393,91 @@ namespace mls
         const T& back() const { return *(--end()) ; }
 
         template<typename U = T>
-        void push_front(U&& el);
+        void push_front(U&& el) { emplace_front(std::forward<U>(el)); }
         template<typename U = T>
-        void push_back(U&& el);
+        void push_back(U&& el) { emplace_back(std::forward<U>(el)); }
+
+        template<typename... Args>
+        T& emplace_front(Args&&... args);
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
 
         void pop_front();
         void pop_back();
 
         template<typename U = T>
-        iterator insert(iterator& it, U&& el);
-        void erase(iterator& it);
+        iterator insert(const_iterator it, U&& el) { return emplace(it, std::forward<U>(el)); }
+        template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        iterator insert(const_iterator it, InputIt first, InputIt last);
+        iterator insert(const_iterator it, std::initializer_list<T> init) { return insert(it, init.begin(), init.end()); }
+        template<typename... Args>
+        iterator emplace(const_iterator it, Args&&... args);
+        iterator erase(const_iterator it);
+        iterator erase(const_iterator first, const_iterator last);
+
+        // Unlink every matching node in one pass and free them together afterwards, so
+        // the value passed to remove() may itself live in the list. Return the count removed.
+        template<typename Predicate>
+        size_t remove_if(Predicate pred);
+        size_t remove(const T& value) { return remove_if([&value](const T& el){ return el == value; }); }
+        template<typename BinaryPredicate>
+        size_t unique(BinaryPredicate pred);
+        size_t unique() { return unique([](const T& a, const T& b){ return a == b; }); }
+
+        // Unlinks a node without destroying it. Reinserting relinks the same node, with no
+        // allocation, only into a list whose allocator compares equal to the source's; for
+        // Pool, Arena and Numa allocators that is the source list itself. Elsewhere the
+        // payload is moved into a new node and the old one is freed.
+        node_type extract(const_iterator it);
+        iterator insert(const_iterator it, node_type&& handle);
+
+        void splice(const_iterator pos, List& other);
+        void splice(const_iterator pos, List&& other) { splice(pos, other); }
+        void splice(const_iterator pos, List& other, const_iterator it);
+        void splice(const_iterator pos, List&& other, const_iterator it) { splice(pos, other, it); }
+        void splice(const_iterator pos, List& other, const_iterator first, const_iterator last);
+        void splice(const_iterator pos, List&& other, const_iterator first, const_iterator last) { splice(pos, other, first, last); }
 
-        void merge(List& other);
-        void merge(List&& other);
-        void swap(List& other);
+        void merge(List& other) { merge_all(other); }
+        void merge(List&& other) { merge_all(other); }
+        template<typename Compare>
+        void merge(List& other, Compare comp);
+        template<typename Compare>
+        void merge(List&& other, Compare comp) { merge(other, comp); }
+        void swap(List& other) noexcept(nothrow_swap_);
+        template<typename Compare>
+        void sort(Compare comp);
         void sort(bool ascending = true);
+
+        // Split the chain into one segment per thread (0 = hardware_concurrency), sort or visit
+        // the segments concurrently and, for sorting, merge them pairwise in parallel rounds.
+        // Short lists fall back to the sequential path.
+        template<typename Compare>
+        void parallel_sort(Compare comp, size_t threads = 0);
+        template<typename F>
+        void parallel_for_each(F f, size_t threads = 0);
         void reverse();
 
+        // Moves every element, in order, into nodes from a fresh copy of the allocator made on
+        // the calling thread, then frees the old nodes. With a placement-aware allocator such as
+        // Numa_Allocator this migrates the chain to the new owner's memory; with any allocator it
+        // packs the nodes in traversal order. Allocators that do not propagate on move assignment
+        // (Inline_Allocator, polymorphic_allocator) cannot take a chain built elsewhere, so the
+        // new nodes come from this list's own allocator instead, which then needs room for both
+        // copies at once; the same happens while an extracted node handle is out. All nodes are allocated before any element moves, so a failed
+        // allocation leaves the list untouched. Iterators and references are invalidated.
+        void rehome();
+
+        // rehome() on the current thread, returning the bytes the allocator gave back when it
+        // can report them (Pool_Allocator, Arena_Allocator, Numa_Allocator) and 0 otherwise.
+        size_t compact();
+        // The same pass in time-bounded slices; see List_Compaction.
+        compaction_type compaction() { return compaction_type(*this); }
+
+        // Counter snapshot for a metrics exporter; all zeros with No_List_Stats.
+        List_Stats stats() const { return stats_policy().snapshot(); }
+        void reset_stats();
+
         iterator begin() { return {fake_node_.next_}; }
         iterator end() { return {&fake_node_}; }
 
@@ -126,281 +487,1293 @@ namespace mls
         const_iterator cbegin() const { return {fake_node_.next_}; }
         const_iterator cend() const { return {&fake_node_}; }
 
-        reverse_iterator rbegin() { return {fake_node_.prev_}; }
-        reverse_iterator rend() { return {&fake_node_}; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
 
-        const_reverse_iterator rbegin() const { return {fake_node_.prev_}; }
-        const_reverse_iterator rend() const { return {&fake_node_}; }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
         
-        const_reverse_iterator crbegin() const { return {fake_node_.prev_}; }
-        const_reverse_iterator crend() const { return {&fake_node_}; }
+        const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
 
     private:
-        void insert_node(List_Node<T>* old_node, List_Node<T>* new_node);
+        static T& data(List_Link* link) { return static_cast<List_Node<T>*>(link)->data_; }
+
+        Stats& stats_policy() { return *this; }
+        const Stats& stats_policy() const { return *this; }
+        void grow(size_t count);
+        // comp itself when Stats does not count, otherwise a wrapper bumping count per call
+        template<typename Compare>
+        static decltype(auto) counting(Compare& comp, size_t& count);
+
+        void insert_node(List_Link* old_node, List_Link* new_node);
+        void take_links(List& other) noexcept;
+        void move_elements(List& other);
+        void repack();
+        void splice_all(List_Link* pos, List& other);
+        void splice_range(List_Link* pos, List& other, List_Link* first, List_Link* last);
+        void merge_all(List& other);
+        static void relink_range(List_Link* pos, List_Link* first, List_Link* last);
+        static void link_chain(List_Link* pos, List_Link* head, List_Link* tail);
+
+        template<typename InputIt>
+        size_t build_chain(InputIt first, InputIt last, List_Link*& head, List_Link*& tail);
+
+        // If comp throws, both leave every node on the chain passed by reference, in no particular order.
+        template<typename Compare>
+        static void merge_chains(List_Link*& first, List_Link* second, Compare& comp);
+        template<typename Compare>
+        static void sort_chain(List_Link*& head, Compare& comp);
+        static void append_chain(List_Link**& tail, List_Link* chain);
+        void relink_chain(List_Link* head);
+
+        static constexpr size_t min_parallel_segment_ = 1 << 14;
+        size_t parallel_segments(size_t threads) const;
+        std::vector<List_Link*> split_chains(size_t threads);
         
-        template<typename U = T>
-        List_Node<T>* obj_construct(U&& el);
-        void obj_destruct(List_Node<T>* del_node);  
+        // Frees a node whose payload has not been constructed (yet) unless node_ is cleared.
+        struct Node_Guard
+        {
+            Node_Alloc& alloc_;
+            List_Node<T>* node_;
+
+            ~Node_Guard() { if(node_) { Node_Traits::deallocate(alloc_, node_, 1); } }
+        };
+
+        // Frees a partly built nullptr-terminated chain unless head_ is cleared.
+        struct Chain_Guard
+        {
+            List& list_;
+            List_Link* head_;
+
+            ~Chain_Guard() { if(head_) { list_.free_chain(head_); } }
+        };
+
+        // Builds the link, then the payload through alloc, which may pass itself on to T.
+        template<typename... Args>
+        static void el_construct(Node_Alloc& alloc, List_Node<T>* node, Args&&... args);
+        template<typename... Args>
+        List_Node<T>* obj_construct(Args&&... args);
+        void obj_destruct(List_Link* del_node) noexcept;
+        size_t free_chain(List_Link* head) noexcept;
 
     public:
         ~List();
     };
 
-    template<typename T, typename Allocator>
-    List<T, Allocator>::List() : fake_node_(0), node_alloc_(), sz_(0) {
-        fake_node_.next_ = &fake_node_;
-        fake_node_.prev_ = &fake_node_;
+    template<typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>::List(const Allocator& alloc) : fake_node_{&fake_node_, &fake_node_}, node_alloc_(alloc), sz_(0) {}
+
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>::List(const List &copy_list)
+        : List(Allocator(Node_Traits::select_on_container_copy_construction(copy_list.node_alloc_)))
+    {
+        insert(end(), copy_list.begin(), copy_list.end());
     }
 
-    template <typename T, typename Allocator>
-    List<T, Allocator>::List(const List &copy_list) : List()
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>::List(List &&move_list) noexcept(nothrow_move_)
+        : fake_node_{&fake_node_, &fake_node_}, node_alloc_(std::move(move_list.node_alloc_)), sz_(0)
     {
-        *this = copy_list;
+        // a propagating allocator brings its nodes along; any other one (inline storage,
+        // polymorphic_allocator) keeps them unless the two compare equal after the copy
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            this->swap_extracted(move_list, node_alloc_, move_list.node_alloc_);
+            take_links(move_list);
+        } else {
+            if(node_alloc_ == move_list.node_alloc_) {
+                take_links(move_list);
+            } else {
+                move_elements(move_list);
+            }
+        }
     }
 
-    template <typename T, typename Allocator>
-    List<T, Allocator>::List(List &&move_list) : List()
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>::List(List &&move_list, const Allocator& alloc) : List(alloc)
     {
-        *this = std::forward<List>(move_list);
+        if(node_alloc_ == move_list.node_alloc_) {
+            take_links(move_list);
+        } else {
+            move_elements(move_list);
+        }
     }
 
-    template <typename T, typename Allocator>
-    List<T, Allocator>& List<T, Allocator>::operator=(const List& copy_list)
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>& List<T, Allocator, Stats>::operator=(const List& copy_list)
     {
-        clear();
-        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
-        {
-            push_back(*it);
+        if(this == &copy_list) { return *this; }
+        if constexpr (Node_Traits::propagate_on_container_copy_assignment::value) {
+            if(node_alloc_ != copy_list.node_alloc_)
+            {
+                // nodes must go back to the allocator that made them before it is replaced
+                clear();
+                node_alloc_ = copy_list.node_alloc_;
+            }
         }
+        assign(copy_list.begin(), copy_list.end());
         return *this;
     }
 
-    template <typename T, typename Allocator>
-    List<T, Allocator> &List<T, Allocator>::operator=(List&& move_list)
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>& List<T, Allocator, Stats>::operator=(std::initializer_list<T> init)
     {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename InputIt, typename>
+    void List<T, Allocator, Stats>::assign(InputIt first, InputIt last)
+    {
+        using category = typename std::iterator_traits<InputIt>::iterator_category;
+        constexpr bool reuse_nodes = std::is_base_of_v<std::forward_iterator_tag, category>
+            && std::is_nothrow_assignable_v<T&, decltype(*first)>;
+
+        List_Link* head = nullptr;
+        List_Link* tail = nullptr;
+        if constexpr (reuse_nodes) {
+            // overwrite payloads of existing nodes in place, allocating only the missing tail;
+            // the tail is built before anything is touched, so a throwing copy leaves *this intact
+            InputIt mid = first;
+            List_Link* node = fake_node_.next_;
+            size_t reused = 0;
+            for (; node != &fake_node_ && mid != last; node = node->next_, ++mid, ++reused) {}
+
+            size_t count = build_chain(mid, last, head, tail);
+            for (List_Link* dst = fake_node_.next_; dst != node; dst = dst->next_, ++first)
+            {
+                data(dst) = *first;
+            }
+
+            if(count) {
+                link_chain(&fake_node_, head, tail);
+            } else if(node != &fake_node_) {
+                List_Link* last_kept = node->prev_;
+                last_kept->next_ = &fake_node_;
+                fake_node_.prev_ = last_kept;
+                while (node != &fake_node_)
+                {
+                    List_Link* next = node->next_;
+                    obj_destruct(node);
+                    node = next;
+                }
+            }
+            sz_ = reused + count;
+            stats_policy().on_size(sz_);
+        } else {
+            size_t count = build_chain(first, last, head, tail);
+
+            // old nodes are freed one by one: a bulk release would also drop the new chain
+            List_Link* del_node = fake_node_.next_;
+            while (del_node != &fake_node_)
+            {
+                List_Link* next = del_node->next_;
+                obj_destruct(del_node);
+                del_node = next;
+            }
+            fake_node_.next_ = &fake_node_;
+            fake_node_.prev_ = &fake_node_;
+
+            if(count) { link_chain(&fake_node_, head, tail); }
+            sz_ = count;
+            stats_policy().on_size(sz_);
+        }
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats> &List<T, Allocator, Stats>::operator=(List&& move_list) noexcept(nothrow_move_)
+    {
+        if(this == &move_list) { return *this; }
         clear();
-        fake_node_.next_ = move_list.fake_node_.next_;
-        fake_node_.prev_ = move_list.fake_node_.prev_;
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            node_alloc_ = std::move(move_list.node_alloc_);
+            this->swap_extracted(move_list, node_alloc_, move_list.node_alloc_);
+        } else {
+            if(node_alloc_ != move_list.node_alloc_)
+            {
+                // nodes owned by another allocator (e.g. inline storage) cannot be stolen
+                move_elements(move_list);
+                return *this;
+            }
+        }
+        take_links(move_list);
+        return *this;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::take_links(List& other) noexcept
+    {
+        if(other.empty()) { return; }
+        fake_node_.next_ = other.fake_node_.next_;
+        fake_node_.prev_ = other.fake_node_.prev_;
         fake_node_.next_->prev_ = &fake_node_;
         fake_node_.prev_->next_ = &fake_node_;
 
-        move_list.fake_node_.next_ = &move_list.fake_node_;
-        move_list.fake_node_.prev_ = &move_list.fake_node_;
-        sz_ = move_list.sz_;
-        move_list.sz_ = 0;
-        return *this;
+        other.fake_node_.next_ = &other.fake_node_;
+        other.fake_node_.prev_ = &other.fake_node_;
+        sz_ = other.sz_;
+        other.sz_ = 0;
+        stats_policy().on_size(sz_);
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::clear()
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::move_elements(List& other)
     {
-        List_Node<T>* del_node = fake_node_.next_;
-        while (del_node != &fake_node_)
+        for (auto it = other.begin(); it != other.end(); ++it)
         {
-            fake_node_.next_ = fake_node_.next_->next_;
-            obj_destruct(del_node);
-            del_node = fake_node_.next_;
+            emplace_back(std::move(*it));
         }
+        other.clear();
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::clear() noexcept
+    {
+        // an extracted handle still owns a slot, so the allocator may only be released wholesale without one
+        bool bulk_release = false;
+        if constexpr (has_bulk_release<Node_Alloc>::value) { bulk_release = !this->has_extracted(); }
+
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            // no destructor can look at the list while it is torn down, so free the chain as is
+            if(sz_ && !bulk_release)
+            {
+                fake_node_.prev_->next_ = nullptr;
+                free_chain(fake_node_.next_);
+            }
+        } else {
+            List_Link* del_node = fake_node_.next_;
+            while (del_node != &fake_node_)
+            {
+                fake_node_.next_ = fake_node_.next_->next_;
+                obj_destruct(del_node);
+                del_node = fake_node_.next_;
+            }
+        }
+        if constexpr (has_bulk_release<Node_Alloc>::value) {
+            if(bulk_release)
+            {
+                if constexpr (std::is_trivially_destructible_v<T>) {
+                    stats_policy().on_destruct(sz_, sz_ * sizeof(List_Node<T>));
+                }
+                node_alloc_.release();
+            }
+        }
+        fake_node_.next_ = &fake_node_;
         fake_node_.prev_ = &fake_node_;
         sz_ = 0;
     }
 
-    template <typename T, typename Allocator>
-    template <typename U>
-    void List<T, Allocator>::push_front(U&& el)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename... Args>
+    T& List<T, Allocator, Stats>::emplace_front(Args&&... args)
     {
-        List_Node<T>* new_node = nullptr;
-        try {
-            new_node = obj_construct(std::forward<U>(el));
-            insert_node(fake_node_.next_, new_node);
-            ++sz_;
-        } catch(...) {
-            obj_destruct(new_node);
-            throw std::bad_alloc();
-        } 
+        List_Node<T>* new_node = obj_construct(std::forward<Args>(args)...);
+        insert_node(fake_node_.next_, new_node);
+        grow(1);
+        return new_node->data_;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename... Args>
+    T& List<T, Allocator, Stats>::emplace_back(Args&&... args)
+    {
+        List_Node<T>* new_node = obj_construct(std::forward<Args>(args)...);
+        insert_node(&fake_node_, new_node);
+        grow(1);
+        return new_node->data_;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename InputIt, typename>
+    typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::insert(const_iterator it, InputIt first, InputIt last)
+    {
+        List_Link* pos = const_cast<List_Link*>(it.node_);
+        List_Link* head = nullptr;
+        List_Link* tail = nullptr;
+        size_t count = build_chain(first, last, head, tail);
+        if(!count) { return iterator(pos); }
+
+        link_chain(pos, head, tail);
+        grow(count);
+        return iterator(head);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename... Args>
+    typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::emplace(const_iterator it, Args&&... args)
+    {
+        List_Node<T>* new_node = obj_construct(std::forward<Args>(args)...);
+        insert_node(const_cast<List_Link*>(it.node_), new_node);
+        grow(1);
+        return iterator(new_node);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::erase(const_iterator it)
+    {
+        List_Link* del_node = const_cast<List_Link*>(it.node_);
+        List_Link* next = del_node->next_;
+        unlink_node(del_node);
+        obj_destruct(del_node);
+        --sz_;
+        return iterator(next);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::erase(const_iterator first, const_iterator last)
+    {
+        List_Link* first_node = const_cast<List_Link*>(first.node_);
+        List_Link* last_node = const_cast<List_Link*>(last.node_);
+        if(first_node == last_node) { return iterator(last_node); }
+
+        first_node->prev_->next_ = last_node;
+        last_node->prev_->next_ = nullptr;
+        last_node->prev_ = first_node->prev_;
+        sz_ -= free_chain(first_node);
+        return iterator(last_node);
     }
 
-    template <typename T, typename Allocator>
-    template <typename U>
-    void List<T, Allocator>::push_back(U&& el)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Predicate>
+    size_t List<T, Allocator, Stats>::remove_if(Predicate pred)
     {
-        List_Node<T>* new_node = nullptr;
+        List_Link* removed = nullptr;
+        List_Link** removed_tail = &removed;
         try {
-            new_node = obj_construct(std::forward<U>(el));
-            insert_node(&fake_node_, new_node);
-            ++sz_;
+            List_Link* node = fake_node_.next_;
+            while (node != &fake_node_)
+            {
+                List_Link* next = node->next_;
+                if(pred(data(node)))
+                {
+                    unlink_node(node);
+                    *removed_tail = node;
+                    removed_tail = &node->next_;
+                }
+                node = next;
+            }
         } catch(...) {
-            obj_destruct(new_node);
-            throw std::bad_alloc();
-        } 
+            *removed_tail = nullptr;
+            sz_ -= free_chain(removed);
+            throw;
+        }
+        *removed_tail = nullptr;
+        size_t count = free_chain(removed);
+        sz_ -= count;
+        return count;
     }
 
-    template <typename T, typename Allocator>
-    template <typename U>
-    typename List<T, Allocator>::iterator List<T, Allocator>::insert(iterator &it, U &&el)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename BinaryPredicate>
+    size_t List<T, Allocator, Stats>::unique(BinaryPredicate pred)
     {
-        List_Node<T>* new_node = nullptr;
+        if(sz_ < 2) { return 0; }
+
+        List_Link* removed = nullptr;
+        List_Link** removed_tail = &removed;
         try {
-            new_node = obj_construct(el);
-            insert_node(it.node_, new_node);
-            ++sz_;
+            // each run collapses onto its first element, which stays linked as kept
+            List_Link* kept = fake_node_.next_;
+            List_Link* node = kept->next_;
+            while (node != &fake_node_)
+            {
+                List_Link* next = node->next_;
+                if(pred(data(kept), data(node))) {
+                    unlink_node(node);
+                    *removed_tail = node;
+                    removed_tail = &node->next_;
+                } else {
+                    kept = node;
+                }
+                node = next;
+            }
         } catch(...) {
-            obj_destruct(new_node);
-            throw std::bad_alloc();
+            *removed_tail = nullptr;
+            sz_ -= free_chain(removed);
+            throw;
         }
-        auto new_it = iterator(new_node);
-        return new_it;
+        *removed_tail = nullptr;
+        size_t count = free_chain(removed);
+        sz_ -= count;
+        return count;
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::erase(iterator &it)
+    template <typename T, typename Allocator, typename Stats>
+    typename List<T, Allocator, Stats>::node_type List<T, Allocator, Stats>::extract(const_iterator it)
     {
-        List_Node<T>* del_node = it.node_;
-        it->prev_->next_ = del_node->next_;
-        del_node->next_->prev_ = del_node->prev_;
-        obj_destruct(del_node);
+        List_Extract_State<Node_Alloc>* state = this->extract_state(node_alloc_);
+        List_Link* node = const_cast<List_Link*>(it.node_);
+        unlink_node(node);
         --sz_;
+        if(state) { ++state->extracted_; }
+        return node_type(static_cast<List_Node<T>*>(node), &node_alloc_, state);
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::merge(List& other)
+    template <typename T, typename Allocator, typename Stats>
+    typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::insert(const_iterator it, node_type&& handle)
     {
-        if(this == &other) { return; }
-        
-        List_Node<T>* new_node = nullptr;
-        for(auto it = other.begin(); it != other.end(); ++it)
+        List_Link* pos = const_cast<List_Link*>(it.node_);
+        if(handle.empty()) { return iterator(pos); }
+        if(handle.allocator() != node_alloc_)
         {
-            try {
-                new_node = obj_construct(*it);
-                insert_node(end().node_, new_node);
-            } catch(...) {
-                obj_destruct(new_node);
-                throw std::bad_alloc();
+            iterator new_it = emplace(it, std::move(handle.value()));
+            handle.reset();
+            return new_it;
+        }
+
+        List_Link* node = handle.release();
+        insert_node(pos, node);
+        grow(1);
+        return iterator(node);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::splice(const_iterator pos, List& other)
+    {
+        stats_policy().on_splice();
+        splice_all(const_cast<List_Link*>(pos.node_), other);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::splice(const_iterator pos, List& other, const_iterator it)
+    {
+        const_iterator next = it;
+        ++next;
+        if(pos == it || pos == next) { return; }
+        stats_policy().on_splice();
+        splice_range(const_cast<List_Link*>(pos.node_), other, const_cast<List_Link*>(it.node_), const_cast<List_Link*>(next.node_));
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::splice(const_iterator pos, List& other, const_iterator first, const_iterator last)
+    {
+        if(first == last) { return; }
+        stats_policy().on_splice();
+        splice_range(const_cast<List_Link*>(pos.node_), other, const_cast<List_Link*>(first.node_), const_cast<List_Link*>(last.node_));
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::splice_all(List_Link* pos, List& other)
+    {
+        if(this == &other || other.empty()) { return; }
+        if(node_alloc_ != other.node_alloc_)
+        {
+            splice_range(pos, other, other.fake_node_.next_, &other.fake_node_);
+            return;
+        }
+
+        relink_range(pos, other.fake_node_.next_, &other.fake_node_);
+        grow(other.sz_);
+        other.sz_ = 0;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::splice_range(List_Link* pos, List& other, List_Link* first_node, List_Link* last_node)
+    {
+        if(this != &other)
+        {
+            if(node_alloc_ != other.node_alloc_)
+            {
+                while (first_node != last_node)
+                {
+                    iterator del_it(first_node);
+                    first_node = first_node->next_;
+                    emplace(const_iterator(pos), std::move(*del_it));
+                    other.erase(del_it);
+                }
+                return;
             }
+
+            size_t count = 0;
+            for (List_Link* node = first_node; node != last_node; node = node->next_) { ++count; }
+            grow(count);
+            other.sz_ -= count;
         }
+        relink_range(pos, first_node, last_node);
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::merge(List&& other)
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::merge_all(List& other)
     {
         if(this == &other) { return; }
+        stats_policy().on_merge();
+        splice_all(&fake_node_, other);
+    }
 
-        fake_node_.prev_->next_ = other.fake_node_.next_;
-        other.fake_node_.next_->prev_ = fake_node_.prev_;
-        fake_node_.prev_ = other.fake_node_.prev_;
-        fake_node_.prev_->next_ = &fake_node_;
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Compare>
+    void List<T, Allocator, Stats>::merge(List& other, Compare comp)
+    {
+        if(this == &other) { return; }
+        stats_policy().on_merge();
 
-        other.fake_node_.next_ = &other.fake_node_;
-        other.fake_node_.prev_ = &other.fake_node_;
+        const bool same_alloc = node_alloc_ == other.node_alloc_;
+        List_Link* pos = fake_node_.next_;
+        while (!other.empty())
+        {
+            List_Link* first = other.fake_node_.next_;
+            while (pos != &fake_node_ && !comp(data(first), data(pos))) { pos = pos->next_; }
+            if(pos == &fake_node_)
+            {
+                splice_all(&fake_node_, other);
+                return;
+            }
 
-        sz_ += other.sz_;
-        other.sz_ = 0;
+            if(!same_alloc)
+            {
+                emplace(const_iterator(pos), std::move(data(first)));
+                other.pop_front();
+                continue;
+            }
+
+            // steal the whole run of other's elements that sorts before pos
+            size_t count = 1;
+            List_Link* last = first->next_;
+            while (last != &other.fake_node_ && comp(data(last), data(pos)))
+            {
+                last = last->next_;
+                ++count;
+            }
+            relink_range(pos, first, last);
+            grow(count);
+            other.sz_ -= count;
+        }
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::swap(List& other)
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::swap(List& other) noexcept(nothrow_swap_)
     {
         if(this == &other) { return; }
+        if constexpr (!Node_Traits::propagate_on_container_swap::value) {
+            if(node_alloc_ != other.node_alloc_)
+            {
+                List tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+                return;
+            }
+        }
+
         std::swap(fake_node_.next_, other.fake_node_.next_);
         std::swap(fake_node_.prev_, other.fake_node_.prev_);
+        if constexpr (Node_Traits::propagate_on_container_swap::value) {
+            std::swap(node_alloc_, other.node_alloc_);
+            this->swap_extracted(other, node_alloc_, other.node_alloc_);
+        }
         std::swap(sz_, other.sz_);
+
+        for (List* list : {this, &other})
+        {
+            List_Link* fake = &list->fake_node_;
+            if(list->empty()) {
+                fake->next_ = fake;
+                fake->prev_ = fake;
+            } else {
+                fake->next_->prev_ = fake;
+                fake->prev_->next_ = fake;
+            }
+        }
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::sort(bool ascending)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Compare>
+    void List<T, Allocator, Stats>::sort(Compare comp)
     {
         if(sz_ < 2) { return; }
 
-        auto lamb = ascending ? [](T& a, T& b){ return a<b; } : [](T& a, T& b){ return a>b; };
-        auto lamb_t = ascending ? [](T& a, T& b){ return a<=b; } : [](T& a, T& b){ return a>=b; };
+        size_t compares = 0;
+        auto&& counted = counting(comp, compares);
+        fake_node_.prev_->next_ = nullptr;
+        List_Link* head = fake_node_.next_;
+        try {
+            sort_chain(head, counted);
+        } catch(...) {
+            relink_chain(head);
+            throw;
+        }
+        relink_chain(head);
+        stats_policy().on_sort(compares);
+    }
 
-        bool flag = true;
-        for (auto it_i = ++begin(); it_i != end();)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Compare>
+    void List<T, Allocator, Stats>::parallel_sort(Compare comp, size_t threads)
+    {
+        std::vector<List_Link*> chains = split_chains(threads);
+        if(chains.size() < 2)
         {
-            auto it_j = it_i;
-            --it_j;
-            for (; it_j != end(); --it_j)
+            sort(comp);
+            return;
+        }
+
+        // every task counts its own comparisons and hands the total back through its future;
+        // all tasks are waited for even after a failure, since they still own their chains
+        std::vector<std::future<size_t>> tasks;
+        size_t compares = 0;
+        std::exception_ptr failure;
+        auto run = [&tasks, &failure](auto&& task) {
+            try {
+                tasks.push_back(std::async(std::launch::async, std::forward<decltype(task)>(task)));
+                return true;
+            } catch(...) {
+                if(!failure) { failure = std::current_exception(); }
+                return false;
+            }
+        };
+        auto wait = [&tasks, &compares, &failure]() {
+            for (auto& task : tasks)
             {
-                auto it_next = it_j;
-                --it_next;
-                if(lamb(*it_i,*it_j) && (it_next == end() || lamb_t(*it_next, *it_i))){
-                    auto it_s = it_i;
-                    ++it_s;
+                try {
+                    compares += task.get();
+                } catch(...) {
+                    if(!failure) { failure = std::current_exception(); }
+                }
+            }
+            tasks.clear();
+        };
 
-                    it_i->next_->prev_ = it_i->prev_;
-                    it_i->prev_->next_ = it_i->next_;
+        for (auto& chain : chains)
+        {
+            run([&chain, comp]() mutable {
+                size_t count = 0;
+                auto&& counted = counting(comp, count);
+                sort_chain(chain, counted);
+                return count;
+            });
+        }
+        wait();
+
+        // pairwise rounds keep every left chain ahead of its right partner, so the result stays stable
+        for (size_t step = 1; !failure && step < chains.size(); step *= 2)
+        {
+            for (size_t i = 0; i + step < chains.size(); i += 2 * step)
+            {
+                bool started = run([&first = chains[i], second = chains[i + step], comp]() mutable {
+                    size_t count = 0;
+                    auto&& counted = counting(comp, count);
+                    merge_chains(first, second, counted);
+                    return count;
+                });
+                if(started) { chains[i + step] = nullptr; }
+            }
+            wait();
+        }
 
-                    insert_node(it_j.node_, it_i.node_);
-                    it_i = it_s;
+        if(failure)
+        {
+            // whatever got merged or not, the surviving chains still hold every node between them
+            List_Link* head = nullptr;
+            List_Link** tail = &head;
+            for (List_Link* chain : chains) { append_chain(tail, chain); }
+            relink_chain(head);
+            std::rethrow_exception(failure);
+        }
+        relink_chain(chains.front());
+        stats_policy().on_sort(compares);
+    }
 
-                    flag = false;
-                    break;
+    template <typename T, typename Allocator, typename Stats>
+    template <typename F>
+    void List<T, Allocator, Stats>::parallel_for_each(F f, size_t threads)
+    {
+        size_t segments = parallel_segments(threads);
+        if(segments < 2)
+        {
+            for (auto it = begin(); it != end(); ++it) { f(*it); }
+            return;
+        }
+
+        std::vector<std::future<void>> tasks;
+        List_Link* node = fake_node_.next_;
+        for (size_t s = 0; s < segments; ++s)
+        {
+            size_t len = sz_ / segments + (s < sz_ % segments);
+            tasks.push_back(std::async(std::launch::async, [&f, node, len]() {
+                List_Link* cur = node;
+                for (size_t i = 0; i < len; ++i, cur = cur->next_) { f(data(cur)); }
+            }));
+            for (size_t i = 0; i < len; ++i) { node = node->next_; }
+        }
+        for (auto& task : tasks) { task.get(); }
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::sort(bool ascending)
+    {
+        if(ascending) {
+            sort([](const T& a, const T& b){ return a < b; });
+        } else {
+            sort([](const T& a, const T& b){ return b < a; });
+        }
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Compare>
+    void List<T, Allocator, Stats>::sort_chain(List_Link*& head, Compare& comp)
+    {
+        // bins[i] holds a sorted nullptr-terminated chain of 2^i nodes (or nullptr);
+        // bins with a larger index always hold earlier elements, which keeps the sort stable.
+        // A chain being merged always sits in a bin, so head and the bins own every node.
+        List_Link* bins[64] = {};
+        try {
+            while (head)
+            {
+                List_Link* carry = head;
+                head = head->next_;
+                carry->next_ = nullptr;
+
+                size_t i = 0;
+                for (; bins[i]; ++i)
+                {
+                    merge_chains(bins[i], carry, comp);
+                    carry = std::exchange(bins[i], nullptr);
+                }
+                bins[i] = carry;
+            }
+
+            for (auto& bin : bins)
+            {
+                if(bin)
+                {
+                    merge_chains(bin, std::exchange(head, nullptr), comp);
+                    head = std::exchange(bin, nullptr);
+                }
+            }
+        } catch(...) {
+            List_Link** tail = &head;
+            append_chain(tail, head);
+            for (auto bin : bins)
+            {
+                if(bin) { append_chain(tail, bin); }
+            }
+            throw;
+        }
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::append_chain(List_Link**& tail, List_Link* chain)
+    {
+        *tail = chain;
+        while (*tail) { tail = &(*tail)->next_; }
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::relink_chain(List_Link* head)
+    {
+        List_Link* prev = &fake_node_;
+        for (List_Link* node = head; node; node = node->next_)
+        {
+            prev->next_ = node;
+            node->prev_ = prev;
+            prev = node;
+        }
+        prev->next_ = &fake_node_;
+        fake_node_.prev_ = prev;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    size_t List<T, Allocator, Stats>::parallel_segments(size_t threads) const
+    {
+        if(!threads) { threads = std::max(1u, std::thread::hardware_concurrency()); }
+        return std::min(threads, sz_ / min_parallel_segment_);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    std::vector<List_Link*> List<T, Allocator, Stats>::split_chains(size_t threads)
+    {
+        size_t segments = parallel_segments(threads);
+        std::vector<List_Link*> chains;
+        if(segments < 2) { return chains; }
+
+        chains.reserve(segments);
+        List_Link* node = fake_node_.next_;
+        for (size_t s = 0; s < segments; ++s)
+        {
+            chains.push_back(node);
+            size_t len = sz_ / segments + (s < sz_ % segments);
+            for (size_t i = 1; i < len; ++i) { node = node->next_; }
+            List_Link* next = node->next_;
+            node->next_ = nullptr;
+            node = next;
+        }
+        return chains;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Compare>
+    void List<T, Allocator, Stats>::merge_chains(List_Link*& first, List_Link* second, Compare& comp)
+    {
+        List_Link* head = nullptr;
+        List_Link** tail = &head;
+        List_Link* rest = first;
+        try {
+            while (rest && second)
+            {
+                if(comp(data(second), data(rest))) {
+                    *tail = second;
+                    second = second->next_;
+                } else {
+                    *tail = rest;
+                    rest = rest->next_;
                 }
+                tail = &(*tail)->next_;
             }
-            if(flag) { ++it_i; }
-            flag = true;
+        } catch(...) {
+            append_chain(tail, rest);
+            append_chain(tail, second);
+            first = head;
+            throw;
         }
+        *tail = rest ? rest : second;
+        first = head;
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::reverse()
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::reverse()
     {
-        for (auto it = begin(); it != end(); --it)
+        List_Link* link = fake_node_.next_;
+        while (link != &fake_node_)
         {
-            std::swap(it->next_, it->prev_);
+            std::swap(link->next_, link->prev_);
+            link = link->prev_;
+        }
+        std::swap(fake_node_.next_, fake_node_.prev_);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::rehome()
+    {
+        if constexpr (!Node_Traits::propagate_on_container_move_assignment::value) {
+            repack();
+        } else {
+            // replacing the allocator would hand an outstanding handle's slab back
+            if(this->has_extracted())
+            {
+                repack();
+                return;
+            }
+            List fresh(Allocator(Node_Traits::select_on_container_copy_construction(node_alloc_)));
+            if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                // take every node up front so a failed allocation leaves *this untouched
+                std::vector<List_Node<T>*> slots;
+                slots.reserve(sz_);
+                try {
+                    for (size_t i = 0; i < sz_; ++i) { slots.push_back(Node_Traits::allocate(fresh.node_alloc_, 1)); }
+                } catch(...) {
+                    for (List_Node<T>* slot : slots) { Node_Traits::deallocate(fresh.node_alloc_, slot, 1); }
+                    throw;
+                }
+
+                List_Link* link = fake_node_.next_;
+                for (List_Node<T>* slot : slots)
+                {
+                    el_construct(fresh.node_alloc_, slot, std::move(data(link)));
+                    link_before(static_cast<List_Link*>(&fresh.fake_node_), static_cast<List_Link*>(slot));
+                    link = link->next_;
+                }
+                fresh.sz_ = sz_;
+            } else {
+                fresh.insert(fresh.end(), cbegin(), cend());
+            }
+            // the copies are made by fresh but belong to this list's account
+            stats_policy().on_construct(fresh.sz_, fresh.sz_ * sizeof(List_Node<T>));
+            *this = std::move(fresh);
         }
-        std::swap(end()->next_, end()->prev_);
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::pop_front()
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::repack()
     {
-        List_Node<T>* del_node = fake_node_.next_;
+        std::vector<List_Node<T>*> slots;
+        slots.reserve(sz_);
+        size_t built = 0;
+        try {
+            for (size_t i = 0; i < sz_; ++i) { slots.push_back(Node_Traits::allocate(node_alloc_, 1)); }
+            for (List_Link* link = fake_node_.next_; link != &fake_node_; link = link->next_, ++built)
+            {
+                el_construct(node_alloc_, slots[built], std::move_if_noexcept(data(link)));
+            }
+        } catch(...) {
+            for (size_t i = 0; i < built; ++i) { Node_Traits::destroy(node_alloc_, std::addressof(slots[i]->data_)); }
+            for (List_Node<T>* slot : slots) { Node_Traits::deallocate(node_alloc_, slot, 1); }
+            throw;
+        }
+
+        if(sz_)
+        {
+            fake_node_.prev_->next_ = nullptr;
+            free_chain(fake_node_.next_);
+        }
+        fake_node_.next_ = fake_node_.prev_ = &fake_node_;
+        for (List_Node<T>* slot : slots) { link_before(static_cast<List_Link*>(&fake_node_), static_cast<List_Link*>(slot)); }
+        stats_policy().on_construct(sz_, sz_ * sizeof(List_Node<T>));
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    size_t List<T, Allocator, Stats>::compact()
+    {
+        if constexpr (has_reserved_bytes<Node_Alloc>::value) {
+            size_t before = node_alloc_.reserved_bytes();
+            rehome();
+            size_t after = node_alloc_.reserved_bytes();
+            return before > after ? before - after : 0;
+        } else {
+            rehome();
+            return 0;
+        }
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::pop_front()
+    {
+        List_Link* del_node = fake_node_.next_;
         fake_node_.next_ = del_node->next_;
         del_node->next_->prev_ = &fake_node_;
         obj_destruct(del_node);
         --sz_;
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::pop_back()
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::pop_back()
     {
-        List_Node<T>* del_node = fake_node_.prev_;
+        List_Link* del_node = fake_node_.prev_;
         fake_node_.prev_ = del_node->prev_;
         del_node->prev_->next_ = &fake_node_;
         obj_destruct(del_node);
         --sz_;
     }
 
-    template <typename T, typename Allocator>
-    template <typename U>
-    List_Node<T>* List<T, Allocator>::obj_construct(U&& el)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename... Args>
+    void List<T, Allocator, Stats>::el_construct(Node_Alloc& alloc, List_Node<T>* node, Args&&... args)
     {
-        List_Node<T>* new_node = node_alloc_.allocate(1);
-        node_alloc_.construct(new_node, std::forward<U>(el));
-        return new_node;
+        Node_Traits::construct(alloc, node);
+        Node_Traits::construct(alloc, std::addressof(node->data_), std::forward<Args>(args)...);
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::insert_node(List_Node<T>* old_node, List_Node<T>* new_node)
+    template <typename T, typename Allocator, typename Stats>
+    template <typename... Args>
+    List_Node<T>* List<T, Allocator, Stats>::obj_construct(Args&&... args)
     {
-        new_node->next_ = old_node;
-        new_node->prev_ = old_node->prev_;
-        old_node->prev_->next_ = new_node;
-        old_node->prev_ = new_node;
+        Node_Guard guard{node_alloc_, Node_Traits::allocate(node_alloc_, 1)};
+        el_construct(node_alloc_, guard.node_, std::forward<Args>(args)...);
+        stats_policy().on_construct(1, sizeof(List_Node<T>));
+        return std::exchange(guard.node_, nullptr);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::reset_stats()
+    {
+        stats_policy().reset();
+        stats_policy().on_size(sz_);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::grow(size_t count)
+    {
+        sz_ += count;
+        stats_policy().on_size(sz_);
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename Compare>
+    decltype(auto) List<T, Allocator, Stats>::counting(Compare& comp, size_t& count)
+    {
+        if constexpr (Stats::enabled) {
+            return [&comp, &count](const T& a, const T& b) {
+                ++count;
+                return comp(a, b);
+            };
+        } else {
+            (void)count;
+            return (comp);
+        }
     }
 
-    template <typename T, typename Allocator>
-    void List<T, Allocator>::obj_destruct(List_Node<T>* del_node)
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::insert_node(List_Link* old_node, List_Link* new_node)
     {
-        node_alloc_.destroy(del_node);
-        node_alloc_.deallocate(del_node, 1);
+        link_before(old_node, new_node);
     }
 
-    template <typename T, typename Allocator>
-    List<T, Allocator>::~List()
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::relink_range(List_Link* pos, List_Link* first, List_Link* last)
+    {
+        List_Link* tail = last->prev_;
+        first->prev_->next_ = last;
+        last->prev_ = first->prev_;
+
+        first->prev_ = pos->prev_;
+        tail->next_ = pos;
+        pos->prev_->next_ = first;
+        pos->prev_ = tail;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::link_chain(List_Link* pos, List_Link* head, List_Link* tail)
+    {
+        head->prev_ = pos->prev_;
+        tail->next_ = pos;
+        pos->prev_->next_ = head;
+        pos->prev_ = tail;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    template <typename InputIt>
+    size_t List<T, Allocator, Stats>::build_chain(InputIt first, InputIt last, List_Link*& head, List_Link*& tail)
+    {
+        size_t count = 0;
+        Chain_Guard guard{*this, nullptr};
+        tail = nullptr;
+        for (; first != last; ++first, ++count)
+        {
+            List_Node<T>* new_node = obj_construct(*first);
+            new_node->prev_ = tail;
+            if(tail) {
+                tail->next_ = new_node;
+            } else {
+                guard.head_ = new_node;
+            }
+            tail = new_node;
+        }
+        head = std::exchange(guard.head_, nullptr);
+        return count;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    void List<T, Allocator, Stats>::obj_destruct(List_Link* del_node) noexcept
+    {
+        List_Node<T>* node = static_cast<List_Node<T>*>(del_node);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            Node_Traits::destroy(node_alloc_, std::addressof(node->data_));
+        }
+        Node_Traits::deallocate(node_alloc_, node, 1);
+        stats_policy().on_destruct(1, sizeof(List_Node<T>));
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    size_t List<T, Allocator, Stats>::free_chain(List_Link* head) noexcept
+    {
+        size_t count = 0;
+        while (head)
+        {
+            List_Link* del_node = head;
+            head = head->next_;
+            obj_destruct(del_node);
+            ++count;
+        }
+        return count;
+    }
+
+    template <typename T, typename Allocator, typename Stats>
+    List<T, Allocator, Stats>::~List()
     {
         clear();
     }
+
+    //----------------------------------------------------------------------------------
+    // Incremental List::compact(). Each step() moves up to max_nodes elements, in traversal
+    // order, into nodes from a fresh copy of the list's allocator and splices them in where the
+    // old nodes were. The old nodes stay allocated, so the new ones cannot land in their slots,
+    // until the last step frees them and hands the fresh allocator to the list. run_for() steps
+    // until a time budget is used up.
+    //
+    // Between steps the list may be read and iterated, but it must not be modified, moved or
+    // destroyed until the compaction is done or gone. Iterators to relocated elements are
+    // invalidated. Destroying an unfinished compaction puts every relocated element back into
+    // its old node without allocating, so the list is left as it was. Elements whose move may
+    // throw are copied and their originals kept until the end, for the same reason.
+    //
+    // Allocators that do not propagate on move assignment cannot be handed over, so they, and
+    // lists with an extracted node handle out, stage the new nodes in the list's own allocator.
+    template<typename T, typename Allocator, typename Stats>
+    class List_Compaction
+    {
+        template<typename, typename, typename>
+        friend class List;
+
+    private:
+        using List_Type = List<T, Allocator, Stats>;
+        using Node_Alloc = typename List_Type::Node_Alloc;
+        using Node_Traits = typename List_Type::Node_Traits;
+
+        // moved-from originals are destroyed right away; otherwise they stay until the end
+        static constexpr bool moves_ = std::is_nothrow_move_constructible_v<T>;
+        static constexpr size_t slice_ = 64;
+
+        List_Type* list_;
+        std::optional<Node_Alloc> fresh_;
+        // next node to relocate; everything before it already lives in the new nodes
+        List_Link* cursor_;
+        // old nodes in relocation order, linked through next_
+        List_Link* retired_;
+        List_Link** retired_tail_;
+        size_t relocated_;
+        size_t reserved_before_;
+        size_t reclaimed_;
+
+        explicit List_Compaction(List_Type& list);
+
+    public:
+        List_Compaction(const List_Compaction& compaction) = delete;
+        List_Compaction& operator=(const List_Compaction& compaction) = delete;
+
+        // Returns true once the list is compacted. A failed allocation throws and leaves the
+        // compaction where it was, so the step can be retried.
+        bool step(size_t max_nodes);
+        template<typename Rep, typename Period>
+        bool run_for(const std::chrono::duration<Rep, Period>& budget);
+        void finish() { while (!step(slice_)) {} }
+
+        bool done() const noexcept { return !list_; }
+        // Bytes the allocator gave back, as for compact(); known once done.
+        size_t reclaimed() const noexcept { return reclaimed_; }
+
+        ~List_Compaction() { cancel(); }
+
+    private:
+        Node_Alloc& target() noexcept { return fresh_ ? *fresh_ : list_->node_alloc_; }
+        size_t reserved_bytes() const noexcept;
+        void complete() noexcept;
+        void cancel() noexcept;
+    };
+
+    template<typename T, typename Allocator, typename Stats>
+    List_Compaction<T, Allocator, Stats>::List_Compaction(List_Type& list)
+        : list_(&list), fresh_(), cursor_(list.fake_node_.next_), retired_(nullptr), retired_tail_(&retired_),
+          relocated_(0), reserved_before_(0), reclaimed_(0)
+    {
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            if(!list.has_extracted()) { fresh_.emplace(Node_Traits::select_on_container_copy_construction(list.node_alloc_)); }
+        }
+        reserved_before_ = reserved_bytes();
+    }
+
+    template<typename T, typename Allocator, typename Stats>
+    bool List_Compaction<T, Allocator, Stats>::step(size_t max_nodes)
+    {
+        if(!list_) { return true; }
+        for (size_t i = 0; i < max_nodes && cursor_ != &list_->fake_node_; ++i)
+        {
+            List_Link* old_node = cursor_;
+            typename List_Type::Node_Guard guard{target(), Node_Traits::allocate(target(), 1)};
+            List_Type::el_construct(target(), guard.node_, std::move_if_noexcept(List_Type::data(old_node)));
+            List_Node<T>* new_node = std::exchange(guard.node_, nullptr);
+            if constexpr (moves_) {
+                Node_Traits::destroy(list_->node_alloc_, std::addressof(static_cast<List_Node<T>*>(old_node)->data_));
+            }
+
+            new_node->next_ = old_node->next_;
+            new_node->prev_ = old_node->prev_;
+            new_node->prev_->next_ = new_node;
+            new_node->next_->prev_ = new_node;
+            cursor_ = new_node->next_;
+
+            old_node->next_ = nullptr;
+            *retired_tail_ = old_node;
+            retired_tail_ = &old_node->next_;
+            ++relocated_;
+        }
+        if(cursor_ != &list_->fake_node_) { return false; }
+        complete();
+        return true;
+    }
+
+    template<typename T, typename Allocator, typename Stats>
+    template<typename Rep, typename Period>
+    bool List_Compaction<T, Allocator, Stats>::run_for(const std::chrono::duration<Rep, Period>& budget)
+    {
+        auto deadline = std::chrono::steady_clock::now() + budget;
+        while (!step(slice_))
+        {
+            if(std::chrono::steady_clock::now() >= deadline) { return false; }
+        }
+        return true;
+    }
+
+    template<typename T, typename Allocator, typename Stats>
+    size_t List_Compaction<T, Allocator, Stats>::reserved_bytes() const noexcept
+    {
+        if constexpr (has_reserved_bytes<Node_Alloc>::value) {
+            return list_->node_alloc_.reserved_bytes() + (fresh_ ? fresh_->reserved_bytes() : 0);
+        } else {
+            return 0;
+        }
+    }
+
+    template<typename T, typename Allocator, typename Stats>
+    void List_Compaction<T, Allocator, Stats>::complete() noexcept
+    {
+        Node_Alloc& old_alloc = list_->node_alloc_;
+        while (retired_)
+        {
+            List_Node<T>* old_node = static_cast<List_Node<T>*>(retired_);
+            retired_ = retired_->next_;
+            if constexpr (!moves_ && !std::is_trivially_destructible_v<T>) {
+                Node_Traits::destroy(old_alloc, std::addressof(old_node->data_));
+            }
+            Node_Traits::deallocate(old_alloc, old_node, 1);
+        }
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            if(fresh_) { old_alloc = std::move(*fresh_); }
+        }
+        fresh_.reset();
+
+        size_t reserved_after = reserved_bytes();
+        reclaimed_ = reserved_before_ > reserved_after ? reserved_before_ - reserved_after : 0;
+        list_->stats_policy().on_construct(relocated_, relocated_ * sizeof(List_Node<T>));
+        list_->stats_policy().on_destruct(relocated_, relocated_ * sizeof(List_Node<T>));
+        list_ = nullptr;
+    }
+
+    template<typename T, typename Allocator, typename Stats>
+    void List_Compaction<T, Allocator, Stats>::cancel() noexcept
+    {
+        if(!list_) { return; }
+        // the relocated elements are exactly the first relocated_ ones, in retirement order
+        List_Link* link = list_->fake_node_.next_;
+        while (retired_)
+        {
+            List_Node<T>* old_node = static_cast<List_Node<T>*>(retired_);
+            List_Node<T>* new_node = static_cast<List_Node<T>*>(link);
+            retired_ = retired_->next_;
+            if constexpr (moves_) {
+                Node_Traits::construct(list_->node_alloc_, std::addressof(old_node->data_), std::move(new_node->data_));
+            }
+
+            old_node->next_ = new_node->next_;
+            old_node->prev_ = new_node->prev_;
+            old_node->prev_->next_ = old_node;
+            old_node->next_->prev_ = old_node;
+            link = old_node->next_;
+
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                Node_Traits::destroy(target(), std::addressof(new_node->data_));
+            }
+            Node_Traits::deallocate(target(), new_node, 1);
+        }
+        list_ = nullptr;
+    }
+
+    //----------------------------------------------------------------------------------
+    // Uniform container erasure (std::erase / std::erase_if counterparts) and swap, found by ADL.
+    template<typename T, typename Allocator, typename Stats, typename U>
+    size_t erase(List<T, Allocator, Stats>& list, const U& value)
+    {
+        return list.remove_if([&value](const T& el){ return el == value; });
+    }
+
+    template<typename T, typename Allocator, typename Stats, typename Predicate>
+    size_t erase_if(List<T, Allocator, Stats>& list, Predicate pred)
+    {
+        return list.remove_if(pred);
+    }
+
+    template<typename T, typename Allocator, typename Stats>
+    void swap(List<T, Allocator, Stats>& a, List<T, Allocator, Stats>& b) noexcept(noexcept(a.swap(b)))
+    {
+        a.swap(b);
+    }
     //----------------------------------------------------------------------------------
 }
\ No newline at end of file
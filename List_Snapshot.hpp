@@ -0,0 +1,246 @@
+#pragma once
+
+#include "List.hpp"
+#include "Compact_List.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Snapshot file: this header, padded to the node alignment, followed by count + 1
+    // Compact_Node<T, uint32_t> records in native byte order. Record 0 is the sentinel and
+    // records are written in list order, so the file is a ready-made Compact_List pool.
+    // Kept out of List.hpp because mapping the file needs POSIX headers.
+    struct Snapshot_Header
+    {
+        char magic_[8];
+        uint32_t version_;
+        uint32_t node_size_;
+        uint64_t count_;
+    };
+
+    constexpr char snapshot_magic_[8] = {'M', 'L', 'S', 'L', 'I', 'S', 'T', '\0'};
+    constexpr uint32_t snapshot_version_ = 1;
+
+    template<typename T>
+    constexpr size_t snapshot_offset_v = (sizeof(Snapshot_Header) + alignof(Compact_Node<T, uint32_t>) - 1)
+        / alignof(Compact_Node<T, uint32_t>) * alignof(Compact_Node<T, uint32_t>);
+
+    //----------------------------------------------------------------------------------
+    // Streams list into write(const char* data, size_t bytes) or into a std::ostream.
+    template<typename T, typename Allocator, typename Stats, typename Writer>
+    void serialize(const List<T, Allocator, Stats>& list, Writer&& write)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "List snapshots need a trivially copyable T");
+        using Node = Compact_Node<T, uint32_t>;
+
+        auto emit = [&write](const void* data, size_t bytes) {
+            if constexpr (std::is_base_of_v<std::ostream, std::decay_t<Writer>>) {
+                write.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+                if(!write) { throw std::runtime_error("mls::serialize: stream write failed"); }
+            } else {
+                write(static_cast<const char*>(data), bytes);
+            }
+        };
+
+        size_t count = list.size();
+        if(count >= UINT32_MAX) { throw std::length_error("mls::serialize: list too long for 32-bit links"); }
+
+        unsigned char header[snapshot_offset_v<T>] = {};
+        Snapshot_Header fields{};
+        std::memcpy(fields.magic_, snapshot_magic_, sizeof(snapshot_magic_));
+        fields.version_ = snapshot_version_;
+        fields.node_size_ = sizeof(Node);
+        fields.count_ = count;
+        std::memcpy(header, &fields, sizeof(fields));
+        emit(header, sizeof(header));
+
+        auto link = [count](Node& node, size_t idx) {
+            node.next_ = static_cast<uint32_t>(idx == count ? 0 : idx + 1);
+            node.prev_ = static_cast<uint32_t>(idx == 0 ? count : idx - 1);
+        };
+
+        constexpr size_t batch_nodes = 4096 / sizeof(Node) + 1;
+        std::vector<Node> batch(batch_nodes);
+        std::memset(static_cast<void*>(batch.data()), 0, batch.size() * sizeof(Node));
+
+        size_t idx = 0;
+        size_t filled = 0;
+        link(batch[filled++], idx++);
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            if(filled == batch_nodes)
+            {
+                emit(batch.data(), filled * sizeof(Node));
+                filled = 0;
+            }
+            Node& node = batch[filled++];
+            link(node, idx++);
+            std::memcpy(node.storage_, &*it, sizeof(T));
+        }
+        emit(batch.data(), filled * sizeof(Node));
+    }
+
+    //----------------------------------------------------------------------------------
+    // Read-only, zero-copy view of a mapped snapshot; iterates the records in place. Loading
+    // walks the links once, so a corrupt or truncated file throws instead of being iterated.
+    template<typename T>
+    class Snapshot_View
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "List snapshots need a trivially copyable T");
+
+    private:
+        using Node = Compact_Node<T, uint32_t>;
+
+    public:
+        using const_iterator = Compact_Iterator<T, uint32_t, true>;
+
+    private:
+        void* map_;
+        size_t bytes_;
+        Node* nodes_;
+        size_t sz_;
+
+    public:
+        explicit Snapshot_View(const std::string& path);
+
+        Snapshot_View(const Snapshot_View& view) = delete;
+        Snapshot_View& operator=(const Snapshot_View& view) = delete;
+        Snapshot_View(Snapshot_View&& view) noexcept;
+        Snapshot_View& operator=(Snapshot_View&& view) noexcept;
+
+        size_t size() const { return sz_; }
+        bool empty() const { return !sz_; }
+
+        const T& front() const { return *begin(); }
+        const T& back() const { return *(--end()); }
+
+        const_iterator begin() const { return {&nodes_, nodes_ ? nodes_->next_ : 0u}; }
+        const_iterator end() const { return {&nodes_, 0}; }
+
+        // Builds an owning List in one bulk insert.
+        template<typename Allocator = std::allocator<T>>
+        List<T, Allocator> to_list() const { return List<T, Allocator>(begin(), end()); }
+
+        ~Snapshot_View();
+
+    private:
+        bool linked() const noexcept;
+        void unmap() noexcept;
+    };
+
+    template<typename T>
+    Snapshot_View<T>::Snapshot_View(const std::string& path) : map_(nullptr), bytes_(0), nodes_(nullptr), sz_(0)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0) { throw std::runtime_error("mls::load_mmap: cannot open " + path); }
+
+        struct stat info;
+        if(::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < snapshot_offset_v<T> + sizeof(Node))
+        {
+            ::close(fd);
+            throw std::runtime_error("mls::load_mmap: " + path + " is not a list snapshot");
+        }
+        bytes_ = static_cast<size_t>(info.st_size);
+        map_ = ::mmap(nullptr, bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(map_ == MAP_FAILED)
+        {
+            map_ = nullptr;
+            throw std::runtime_error("mls::load_mmap: cannot map " + path);
+        }
+
+        Snapshot_Header header;
+        std::memcpy(&header, map_, sizeof(header));
+        bool valid = std::memcmp(header.magic_, snapshot_magic_, sizeof(snapshot_magic_)) == 0
+            && header.version_ == snapshot_version_ && header.node_size_ == sizeof(Node)
+            && header.count_ < UINT32_MAX && (bytes_ - snapshot_offset_v<T>) / sizeof(Node) > header.count_;
+        if(!valid)
+        {
+            unmap();
+            throw std::runtime_error("mls::load_mmap: " + path + " is not a snapshot of this element type");
+        }
+
+        // the mapping is read-only; nodes are only ever read through const iterators
+        nodes_ = reinterpret_cast<Node*>(static_cast<unsigned char*>(map_) + snapshot_offset_v<T>);
+        sz_ = static_cast<size_t>(header.count_);
+        if(!linked())
+        {
+            unmap();
+            throw std::runtime_error("mls::load_mmap: " + path + " has corrupt links");
+        }
+    }
+
+    // Every link must stay inside the count + 1 records, agree with its partner and bring
+    // the forward walk back to the sentinel after exactly count steps.
+    template<typename T>
+    bool Snapshot_View<T>::linked() const noexcept
+    {
+        const uint32_t last = static_cast<uint32_t>(sz_);
+        uint32_t idx = 0;
+        for (size_t steps = 0; steps <= sz_; ++steps)
+        {
+            uint32_t next = nodes_[idx].next_;
+            if(next > last || nodes_[next].prev_ != idx) { return false; }
+            idx = next;
+            if(!idx) { return steps == sz_; }
+        }
+        return false;
+    }
+
+    template<typename T>
+    Snapshot_View<T>::Snapshot_View(Snapshot_View&& view) noexcept
+        : map_(std::exchange(view.map_, nullptr)), bytes_(std::exchange(view.bytes_, 0)),
+          nodes_(std::exchange(view.nodes_, nullptr)), sz_(std::exchange(view.sz_, 0)) {}
+
+    template<typename T>
+    Snapshot_View<T>& Snapshot_View<T>::operator=(Snapshot_View&& view) noexcept
+    {
+        if(this != &view)
+        {
+            unmap();
+            map_ = std::exchange(view.map_, nullptr);
+            bytes_ = std::exchange(view.bytes_, 0);
+            nodes_ = std::exchange(view.nodes_, nullptr);
+            sz_ = std::exchange(view.sz_, 0);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    void Snapshot_View<T>::unmap() noexcept
+    {
+        if(map_) { ::munmap(map_, bytes_); }
+        map_ = nullptr;
+        bytes_ = 0;
+        nodes_ = nullptr;
+        sz_ = 0;
+    }
+
+    template<typename T>
+    Snapshot_View<T>::~Snapshot_View()
+    {
+        unmap();
+    }
+
+    //----------------------------------------------------------------------------------
+    template<typename T>
+    Snapshot_View<T> load_mmap(const std::string& path)
+    {
+        return Snapshot_View<T>(path);
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "List.hpp"
+#include "Pool_Allocator.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    template<typename K, typename V>
+    struct Lru_Entry
+    {
+        K key_;
+        V value_;
+
+        template<typename Key, typename Value>
+        Lru_Entry(Key&& key, Value&& value) : key_(std::forward<Key>(key)), value_(std::forward<Value>(value)) {}
+    };
+
+    //----------------------------------------------------------------------------------
+    // Recency chain is a List whose nodes all come from one Pool_Allocator block of Capacity
+    // slots; a hit is an O(1) relink to the front. Once full, a put recycles the least recently
+    // used node and its hash index entry in place, so a warm cache no longer allocates.
+    template<typename K, typename V, size_t Capacity, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class Lru_Cache
+    {
+        static_assert(Capacity > 0, "Lru_Cache needs room for at least one entry");
+
+    private:
+        using Entry = Lru_Entry<K, V>;
+        using Chain = List<Entry, Pool_Allocator<Entry, Capacity>>;
+        using Index = std::unordered_map<K, typename Chain::iterator, Hash, KeyEqual>;
+
+        Chain chain_;
+        Index index_;
+        size_t hits_;
+        size_t misses_;
+
+    public:
+        Lru_Cache() : chain_(), index_(), hits_(0), misses_(0) { index_.reserve(Capacity); }
+
+        Lru_Cache(const Lru_Cache& copy_cache) = delete;
+        Lru_Cache& operator=(const Lru_Cache& copy_cache) = delete;
+
+        size_t size() const { return chain_.size(); }
+        bool empty() const { return chain_.empty(); }
+        static constexpr size_t capacity() { return Capacity; }
+
+        size_t hits() const { return hits_; }
+        size_t misses() const { return misses_; }
+        void reset_stats() { hits_ = misses_ = 0; }
+
+        // Marks the entry most recently used; nullptr on a miss.
+        V* get(const K& key);
+        // Looks up without touching recency or the hit/miss counters.
+        const V* peek(const K& key) const;
+        bool contains(const K& key) const { return index_.count(key); }
+
+        // Inserts or overwrites key as the most recently used entry; returns true if
+        // the least recently used entry was evicted to make room.
+        template<typename Value>
+        bool put(const K& key, Value&& value);
+        bool erase(const K& key);
+        void clear();
+    };
+
+    template<typename K, typename V, size_t Capacity, typename Hash, typename KeyEqual>
+    V* Lru_Cache<K, V, Capacity, Hash, KeyEqual>::get(const K& key)
+    {
+        auto found = index_.find(key);
+        if(found == index_.end())
+        {
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        chain_.splice(chain_.begin(), chain_, found->second);
+        return &(*found->second).value_;
+    }
+
+    template<typename K, typename V, size_t Capacity, typename Hash, typename KeyEqual>
+    const V* Lru_Cache<K, V, Capacity, Hash, KeyEqual>::peek(const K& key) const
+    {
+        auto found = index_.find(key);
+        if(found == index_.end()) { return nullptr; }
+        typename Chain::iterator entry = found->second;
+        return &(*entry).value_;
+    }
+
+    template<typename K, typename V, size_t Capacity, typename Hash, typename KeyEqual>
+    template<typename Value>
+    bool Lru_Cache<K, V, Capacity, Hash, KeyEqual>::put(const K& key, Value&& value)
+    {
+        auto found = index_.find(key);
+        if(found != index_.end())
+        {
+            (*found->second).value_ = std::forward<Value>(value);
+            chain_.splice(chain_.begin(), chain_, found->second);
+            return false;
+        }
+
+        if(chain_.size() < Capacity)
+        {
+            chain_.emplace_front(key, std::forward<Value>(value));
+            index_.emplace(key, chain_.begin());
+            return false;
+        }
+
+        // reuse the oldest node and its index entry for the new key; the chain is only
+        // relinked once the index holds the new key, and any failure before that evicts the
+        // oldest entry from both, so the two never disagree
+        auto oldest = --chain_.end();
+        auto handle = index_.extract((*oldest).key_);
+        try {
+            handle.key() = key;
+            (*oldest).key_ = key;
+            (*oldest).value_ = std::forward<Value>(value);
+            index_.insert(std::move(handle));
+        } catch(...) {
+            chain_.erase(oldest);
+            throw;
+        }
+        chain_.splice(chain_.begin(), chain_, oldest);
+        return true;
+    }
+
+    template<typename K, typename V, size_t Capacity, typename Hash, typename KeyEqual>
+    bool Lru_Cache<K, V, Capacity, Hash, KeyEqual>::erase(const K& key)
+    {
+        auto found = index_.find(key);
+        if(found == index_.end()) { return false; }
+        chain_.erase(found->second);
+        index_.erase(found);
+        return true;
+    }
+
+    template<typename K, typename V, size_t Capacity, typename Hash, typename KeyEqual>
+    void Lru_Cache<K, V, Capacity, Hash, KeyEqual>::clear()
+    {
+        index_.clear();
+        chain_.clear();
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    struct Mpsc_Link
+    {
+        std::atomic<Mpsc_Link*> next_;
+
+        Mpsc_Link() : next_(nullptr) {}
+        Mpsc_Link(const Mpsc_Link& link) = delete;
+        Mpsc_Link& operator=(const Mpsc_Link& link) = delete;
+    };
+
+    template<typename T>
+    struct Mpsc_Node : Mpsc_Link
+    {
+        // constructed and destroyed by the list through its allocator, apart from the link
+        union { T data_; };
+
+        Mpsc_Node() : Mpsc_Link() {}
+        ~Mpsc_Node() {}
+    };
+
+    //----------------------------------------------------------------------------------
+    // Multi-producer / single-consumer list: any number of threads may push_back
+    // concurrently, one thread pops from the front. Producers are wait-free (one exchange
+    // and one store, plus whatever the allocator costs); the consumer is not lock-free, as
+    // a producer stalled between its exchange and its store hides every element pushed
+    // after it until it resumes. Producers only touch the node they exchanged out of tail_,
+    // and the consumer never moves past a node whose next_ is still unpublished, so a node
+    // is never freed while a producer can reach it and no hazard pointers or epochs are
+    // needed. Allocator must be safe to call from several threads.
+    template<typename T, typename Allocator = std::allocator<T>>
+    class Mpsc_List
+    {
+    private:
+        using Node = Mpsc_Node<T>;
+        using Node_Alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using Node_Traits = std::allocator_traits<Node_Alloc>;
+
+        // head_ is the consumer's dummy: either stub_ or the last popped node, whose payload
+        // is already destroyed. Producers and consumer live on separate cache lines.
+        alignas(64) Mpsc_Link* head_;
+        alignas(64) std::atomic<Mpsc_Link*> tail_;
+        Mpsc_Link stub_;
+        Node_Alloc node_alloc_;
+
+    public:
+        Mpsc_List();
+        explicit Mpsc_List(const Allocator& alloc);
+
+        Mpsc_List(const Mpsc_List& copy_list) = delete;
+        Mpsc_List& operator=(const Mpsc_List& copy_list) = delete;
+
+        // Safe from any number of threads.
+        template<typename U = T>
+        void push_back(U&& el) { emplace_back(std::forward<U>(el)); }
+        template<typename... Args>
+        void emplace_back(Args&&... args);
+
+        // Consumer only. Returns false if nothing has been published yet, including when the
+        // next element's producer is stalled between its two link steps; that element and
+        // everything pushed after it stay hidden until the producer resumes.
+        bool try_pop_front(T& out);
+        // Consumer only. Spins (yielding) until an element arrives, so it blocks for as long
+        // as a stalled producer does.
+        T pop_front();
+        bool empty() const { return !head_->next_.load(std::memory_order_acquire); }
+
+        ~Mpsc_List();
+
+    private:
+        void el_destruct(Mpsc_Link* link) { Node_Traits::destroy(node_alloc_, std::addressof(static_cast<Node*>(link)->data_)); }
+        void free_dummy(Mpsc_Link* dummy);
+    };
+
+    template<typename T, typename Allocator>
+    Mpsc_List<T, Allocator>::Mpsc_List() : head_(&stub_), tail_(&stub_), stub_(), node_alloc_() {}
+
+    template<typename T, typename Allocator>
+    Mpsc_List<T, Allocator>::Mpsc_List(const Allocator& alloc) : head_(&stub_), tail_(&stub_), stub_(), node_alloc_(alloc) {}
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    void Mpsc_List<T, Allocator>::emplace_back(Args&&... args)
+    {
+        Node* new_node = Node_Traits::allocate(node_alloc_, 1);
+        Node_Traits::construct(node_alloc_, new_node);
+        try {
+            Node_Traits::construct(node_alloc_, std::addressof(new_node->data_), std::forward<Args>(args)...);
+        } catch(...) {
+            Node_Traits::destroy(node_alloc_, new_node);
+            Node_Traits::deallocate(node_alloc_, new_node, 1);
+            throw;
+        }
+
+        Mpsc_Link* prev = tail_.exchange(new_node, std::memory_order_acq_rel);
+        prev->next_.store(new_node, std::memory_order_release);
+    }
+
+    template<typename T, typename Allocator>
+    bool Mpsc_List<T, Allocator>::try_pop_front(T& out)
+    {
+        Mpsc_Link* next = head_->next_.load(std::memory_order_acquire);
+        if(!next) { return false; }
+
+        Node* node = static_cast<Node*>(next);
+        out = std::move(node->data_);
+        el_destruct(node);
+
+        Mpsc_Link* old_head = head_;
+        head_ = next;
+        free_dummy(old_head);
+        return true;
+    }
+
+    template<typename T, typename Allocator>
+    T Mpsc_List<T, Allocator>::pop_front()
+    {
+        Mpsc_Link* next = head_->next_.load(std::memory_order_acquire);
+        while (!next)
+        {
+            std::this_thread::yield();
+            next = head_->next_.load(std::memory_order_acquire);
+        }
+
+        Node* node = static_cast<Node*>(next);
+        T el(std::move(node->data_));
+        el_destruct(node);
+
+        Mpsc_Link* old_head = head_;
+        head_ = next;
+        free_dummy(old_head);
+        return el;
+    }
+
+    template<typename T, typename Allocator>
+    void Mpsc_List<T, Allocator>::free_dummy(Mpsc_Link* dummy)
+    {
+        if(dummy == &stub_) { return; }
+        Node* del_node = static_cast<Node*>(dummy);
+        Node_Traits::destroy(node_alloc_, del_node);
+        Node_Traits::deallocate(node_alloc_, del_node, 1);
+    }
+
+    template<typename T, typename Allocator>
+    Mpsc_List<T, Allocator>::~Mpsc_List()
+    {
+        Mpsc_Link* next = head_->next_.load(std::memory_order_acquire);
+        while (next)
+        {
+            el_destruct(next);
+            free_dummy(head_);
+            head_ = next;
+            next = head_->next_.load(std::memory_order_acquire);
+        }
+        free_dummy(head_);
+    }
+    //----------------------------------------------------------------------------------
+}
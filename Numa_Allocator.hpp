@@ -0,0 +1,238 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Slab pool like Pool_Allocator whose slabs are fresh pages bound to one NUMA node.
+    // With the default node -1 each slab prefers the node of the thread that creates it, so a
+    // List filled by its owning thread keeps its nodes in that socket's memory. Copies keep the
+    // placement but start with no slabs, except the copy a container makes for itself
+    // (select_on_container_copy_construction), which targets the calling thread's node; that is
+    // how List copies and List::rehome() move a chain to its new owner. Binding is best effort:
+    // on kernels or platforms without NUMA policy support slabs are ordinary first-touch memory.
+    template<typename T, size_t NodesPerBlock = 1024>
+    class Numa_Allocator
+    {
+        static_assert(NodesPerBlock > 0, "Numa_Allocator needs at least one slot per block");
+
+        template<typename, size_t>
+        friend class Numa_Allocator;
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        // slabs travel with the nodes they hold
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template<typename U>
+        struct rebind { using other = Numa_Allocator<U, NodesPerBlock>; };
+
+        static constexpr int local_node = -1;
+
+    private:
+        union Slot
+        {
+            Slot* next_;
+            alignas(T) unsigned char storage_[sizeof(T)];
+        };
+
+        struct Block
+        {
+            Block* next_;
+            Slot slots_[NodesPerBlock];
+        };
+
+        Block* blocks_;
+        Slot* free_slots_;
+        size_t used_in_block_;
+        int node_;
+
+    public:
+        explicit Numa_Allocator(int node = local_node) noexcept
+            : blocks_(nullptr), free_slots_(nullptr), used_in_block_(NodesPerBlock), node_(node) {}
+
+        Numa_Allocator(const Numa_Allocator& other) noexcept : Numa_Allocator(other.node_) {}
+        template<typename U>
+        Numa_Allocator(const Numa_Allocator<U, NodesPerBlock>& other) noexcept : Numa_Allocator(other.node_) {}
+        Numa_Allocator(Numa_Allocator&& other) noexcept;
+
+        Numa_Allocator& operator=(const Numa_Allocator&) noexcept { return *this; }
+        Numa_Allocator& operator=(Numa_Allocator&& other) noexcept;
+
+        Numa_Allocator select_on_container_copy_construction() const noexcept { return Numa_Allocator(current_node()); }
+
+        T* allocate(size_t n);
+        void deallocate(T* p, size_t n) noexcept;
+
+        // Placement for slabs created from now on; existing slabs stay where they are.
+        int node() const noexcept { return node_; }
+        void set_node(int node) noexcept { node_ = node; }
+        // NUMA node of the CPU the calling thread runs on, local_node if unknown.
+        static int current_node() noexcept;
+
+        // Frees every slab at once; any object still living in the pool must be trivially destructible.
+        void release() noexcept;
+        // Bytes currently held in slabs, whether handed out or not.
+        size_t reserved_bytes() const noexcept;
+
+        bool operator==(const Numa_Allocator& other) const noexcept { return this == &other; }
+        bool operator!=(const Numa_Allocator& other) const noexcept { return this != &other; }
+
+        ~Numa_Allocator() { release(); }
+
+    private:
+        static size_t block_bytes() noexcept;
+        Block* new_block();
+        static void free_block(Block* block) noexcept;
+    };
+
+    template<typename T, size_t NodesPerBlock>
+    Numa_Allocator<T, NodesPerBlock>::Numa_Allocator(Numa_Allocator&& other) noexcept
+        : blocks_(other.blocks_), free_slots_(other.free_slots_), used_in_block_(other.used_in_block_), node_(other.node_)
+    {
+        other.blocks_ = nullptr;
+        other.free_slots_ = nullptr;
+        other.used_in_block_ = NodesPerBlock;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    Numa_Allocator<T, NodesPerBlock>& Numa_Allocator<T, NodesPerBlock>::operator=(Numa_Allocator&& other) noexcept
+    {
+        if(this == &other) { return *this; }
+        release();
+        std::swap(blocks_, other.blocks_);
+        std::swap(free_slots_, other.free_slots_);
+        std::swap(used_in_block_, other.used_in_block_);
+        node_ = other.node_;
+        return *this;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    T* Numa_Allocator<T, NodesPerBlock>::allocate(size_t n)
+    {
+        if(n != 1) { return std::allocator<T>().allocate(n); }
+
+        if(free_slots_)
+        {
+            Slot* slot = free_slots_;
+            free_slots_ = slot->next_;
+            return reinterpret_cast<T*>(slot->storage_);
+        }
+        if(used_in_block_ == NodesPerBlock)
+        {
+            Block* block = new_block();
+            block->next_ = blocks_;
+            blocks_ = block;
+            used_in_block_ = 0;
+        }
+        return reinterpret_cast<T*>(blocks_->slots_[used_in_block_++].storage_);
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    void Numa_Allocator<T, NodesPerBlock>::deallocate(T* p, size_t n) noexcept
+    {
+        if(n != 1)
+        {
+            std::allocator<T>().deallocate(p, n);
+            return;
+        }
+        Slot* slot = reinterpret_cast<Slot*>(p);
+        slot->next_ = free_slots_;
+        free_slots_ = slot;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    int Numa_Allocator<T, NodesPerBlock>::current_node() noexcept
+    {
+#if defined(__linux__) && defined(SYS_getcpu)
+        unsigned cpu = 0;
+        unsigned node = 0;
+        if(::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) { return static_cast<int>(node); }
+#endif
+        return local_node;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    void Numa_Allocator<T, NodesPerBlock>::release() noexcept
+    {
+        while (blocks_)
+        {
+            Block* del_block = blocks_;
+            blocks_ = blocks_->next_;
+            free_block(del_block);
+        }
+        free_slots_ = nullptr;
+        used_in_block_ = NodesPerBlock;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    size_t Numa_Allocator<T, NodesPerBlock>::reserved_bytes() const noexcept
+    {
+        size_t bytes = 0;
+        for (Block* block = blocks_; block; block = block->next_) { bytes += block_bytes(); }
+        return bytes;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    size_t Numa_Allocator<T, NodesPerBlock>::block_bytes() noexcept
+    {
+#if defined(__linux__)
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return (sizeof(Block) + page - 1) / page * page;
+#else
+        return sizeof(Block);
+#endif
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    typename Numa_Allocator<T, NodesPerBlock>::Block* Numa_Allocator<T, NodesPerBlock>::new_block()
+    {
+#if defined(__linux__)
+        // fresh pages are not backed until first touched, so the policy set here decides placement
+        void* mem = ::mmap(nullptr, block_bytes(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(mem == MAP_FAILED) { throw std::bad_alloc(); }
+#if defined(SYS_mbind)
+        constexpr int mpol_preferred = 1;
+        constexpr size_t mask_bits = 8 * sizeof(unsigned long);
+        if(node_ >= 0 && static_cast<size_t>(node_) < 16 * mask_bits) {
+            unsigned long mask[16] = {};
+            mask[node_ / mask_bits] = 1ul << (node_ % mask_bits);
+            ::syscall(SYS_mbind, mem, block_bytes(), mpol_preferred, mask, 16 * mask_bits + 1, 0);
+        } else {
+            // preferred with an empty node mask means "the node of the CPU touching the page"
+            ::syscall(SYS_mbind, mem, block_bytes(), mpol_preferred, nullptr, 0, 0);
+        }
+#endif
+        return ::new(mem) Block;
+#else
+        return new Block;
+#endif
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    void Numa_Allocator<T, NodesPerBlock>::free_block(Block* block) noexcept
+    {
+#if defined(__linux__)
+        ::munmap(block, block_bytes());
+#else
+        delete block;
+#endif
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "List.hpp"
+
+#include <execution>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Execution-policy front end for List::parallel_sort / parallel_for_each. Kept out of
+    // List.hpp because <execution> may require linking a parallel backend such as TBB.
+    template<typename ExecutionPolicy>
+    constexpr bool is_sequenced_policy_v = std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+
+    template<typename ExecutionPolicy, typename T, typename Allocator, typename Stats, typename Compare>
+    std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>
+    sort(ExecutionPolicy&&, List<T, Allocator, Stats>& list, Compare comp)
+    {
+        if constexpr (is_sequenced_policy_v<ExecutionPolicy>) {
+            list.sort(comp);
+        } else {
+            list.parallel_sort(comp);
+        }
+    }
+
+    template<typename ExecutionPolicy, typename T, typename Allocator, typename Stats>
+    std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>
+    sort(ExecutionPolicy&& policy, List<T, Allocator, Stats>& list)
+    {
+        sort(std::forward<ExecutionPolicy>(policy), list, [](const T& a, const T& b){ return a < b; });
+    }
+
+    template<typename ExecutionPolicy, typename T, typename Allocator, typename Stats, typename F>
+    std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>>
+    for_each(ExecutionPolicy&&, List<T, Allocator, Stats>& list, F f)
+    {
+        if constexpr (is_sequenced_policy_v<ExecutionPolicy>) {
+            for (auto it = list.begin(); it != list.end(); ++it) { f(*it); }
+        } else {
+            list.parallel_for_each(f);
+        }
+    }
+    //----------------------------------------------------------------------------------
+}
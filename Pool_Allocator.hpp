@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Hands out single objects from slabs of NodesPerBlock slots with its own free list.
+    // Every instance owns its slabs, so each List gets a private pool; copies start empty
+    // and two instances compare equal only if they are the same pool.
+    template<typename T, size_t NodesPerBlock = 1024>
+    class Pool_Allocator
+    {
+        static_assert(NodesPerBlock > 0, "Pool_Allocator needs at least one slot per block");
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        // slabs travel with the nodes they hold
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template<typename U>
+        struct rebind { using other = Pool_Allocator<U, NodesPerBlock>; };
+
+    private:
+        union Slot
+        {
+            Slot* next_;
+            alignas(T) unsigned char storage_[sizeof(T)];
+        };
+
+        struct Block
+        {
+            Block* next_;
+            Slot slots_[NodesPerBlock];
+        };
+
+        Block* blocks_;
+        Slot* free_slots_;
+        size_t used_in_block_;
+
+    public:
+        Pool_Allocator() noexcept : blocks_(nullptr), free_slots_(nullptr), used_in_block_(NodesPerBlock) {}
+
+        Pool_Allocator(const Pool_Allocator&) noexcept : Pool_Allocator() {}
+        template<typename U>
+        Pool_Allocator(const Pool_Allocator<U, NodesPerBlock>&) noexcept : Pool_Allocator() {}
+        Pool_Allocator(Pool_Allocator&& other) noexcept;
+
+        Pool_Allocator& operator=(const Pool_Allocator&) noexcept { return *this; }
+        Pool_Allocator& operator=(Pool_Allocator&& other) noexcept;
+
+        T* allocate(size_t n);
+        void deallocate(T* p, size_t n) noexcept;
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args) { ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+        template<typename U>
+        void destroy(U* p) { p->~U(); }
+
+        // Frees every slab at once; any object still living in the pool must be trivially destructible.
+        void release() noexcept;
+        // Bytes currently held in slabs, whether handed out or not.
+        size_t reserved_bytes() const noexcept;
+
+        bool operator==(const Pool_Allocator& other) const noexcept { return this == &other; }
+        bool operator!=(const Pool_Allocator& other) const noexcept { return this != &other; }
+
+        ~Pool_Allocator() { release(); }
+    };
+
+    template<typename T, size_t NodesPerBlock>
+    Pool_Allocator<T, NodesPerBlock>::Pool_Allocator(Pool_Allocator&& other) noexcept
+        : blocks_(other.blocks_), free_slots_(other.free_slots_), used_in_block_(other.used_in_block_)
+    {
+        other.blocks_ = nullptr;
+        other.free_slots_ = nullptr;
+        other.used_in_block_ = NodesPerBlock;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    Pool_Allocator<T, NodesPerBlock>& Pool_Allocator<T, NodesPerBlock>::operator=(Pool_Allocator&& other) noexcept
+    {
+        if(this == &other) { return *this; }
+        release();
+        std::swap(blocks_, other.blocks_);
+        std::swap(free_slots_, other.free_slots_);
+        std::swap(used_in_block_, other.used_in_block_);
+        return *this;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    T* Pool_Allocator<T, NodesPerBlock>::allocate(size_t n)
+    {
+        if(n != 1) { return std::allocator<T>().allocate(n); }
+
+        if(free_slots_)
+        {
+            Slot* slot = free_slots_;
+            free_slots_ = slot->next_;
+            return reinterpret_cast<T*>(slot->storage_);
+        }
+        if(used_in_block_ == NodesPerBlock)
+        {
+            Block* block = new Block;
+            block->next_ = blocks_;
+            blocks_ = block;
+            used_in_block_ = 0;
+        }
+        return reinterpret_cast<T*>(blocks_->slots_[used_in_block_++].storage_);
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    void Pool_Allocator<T, NodesPerBlock>::deallocate(T* p, size_t n) noexcept
+    {
+        if(n != 1)
+        {
+            std::allocator<T>().deallocate(p, n);
+            return;
+        }
+        Slot* slot = reinterpret_cast<Slot*>(p);
+        slot->next_ = free_slots_;
+        free_slots_ = slot;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    size_t Pool_Allocator<T, NodesPerBlock>::reserved_bytes() const noexcept
+    {
+        size_t bytes = 0;
+        for (Block* block = blocks_; block; block = block->next_) { bytes += sizeof(Block); }
+        return bytes;
+    }
+
+    template<typename T, size_t NodesPerBlock>
+    void Pool_Allocator<T, NodesPerBlock>::release() noexcept
+    {
+        while (blocks_)
+        {
+            Block* del_block = blocks_;
+            blocks_ = blocks_->next_;
+            delete del_block;
+        }
+        free_slots_ = nullptr;
+        used_in_block_ = NodesPerBlock;
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "List.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Serves the first N single-object allocations from slots embedded in the allocator
+    // itself and only then falls back to the heap. The slots cannot follow a move, so the
+    // allocator never propagates and instances compare equal only to themselves: List then
+    // moves and swaps element-wise instead of stealing nodes out of inline storage.
+    template<typename T, size_t N>
+    class Inline_Allocator
+    {
+        static_assert(N > 0, "Inline_Allocator needs at least one inline slot");
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+
+        template<typename U>
+        struct rebind { using other = Inline_Allocator<U, N>; };
+
+    private:
+        union Slot
+        {
+            Slot* next_;
+            alignas(T) unsigned char storage_[sizeof(T)];
+        };
+
+        Slot slots_[N];
+        Slot* free_slots_;
+        size_t used_;
+
+    public:
+        Inline_Allocator() noexcept : free_slots_(nullptr), used_(0) {}
+
+        Inline_Allocator(const Inline_Allocator&) noexcept : Inline_Allocator() {}
+        template<typename U>
+        Inline_Allocator(const Inline_Allocator<U, N>&) noexcept : Inline_Allocator() {}
+
+        Inline_Allocator& operator=(const Inline_Allocator&) noexcept { return *this; }
+
+        T* allocate(size_t n);
+        void deallocate(T* p, size_t n) noexcept;
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args) { ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...); }
+        template<typename U>
+        void destroy(U* p) { p->~U(); }
+
+        bool owns(const T* p) const noexcept;
+
+        bool operator==(const Inline_Allocator& other) const noexcept { return this == &other; }
+        bool operator!=(const Inline_Allocator& other) const noexcept { return this != &other; }
+    };
+
+    template<typename T, size_t N>
+    T* Inline_Allocator<T, N>::allocate(size_t n)
+    {
+        if(n == 1)
+        {
+            if(free_slots_)
+            {
+                Slot* slot = free_slots_;
+                free_slots_ = slot->next_;
+                return reinterpret_cast<T*>(slot->storage_);
+            }
+            if(used_ < N) { return reinterpret_cast<T*>(slots_[used_++].storage_); }
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    template<typename T, size_t N>
+    void Inline_Allocator<T, N>::deallocate(T* p, size_t n) noexcept
+    {
+        if(!owns(p))
+        {
+            std::allocator<T>().deallocate(p, n);
+            return;
+        }
+        Slot* slot = reinterpret_cast<Slot*>(p);
+        slot->next_ = free_slots_;
+        free_slots_ = slot;
+    }
+
+    template<typename T, size_t N>
+    bool Inline_Allocator<T, N>::owns(const T* p) const noexcept
+    {
+        auto addr = reinterpret_cast<const unsigned char*>(p);
+        std::less<const unsigned char*> less;
+        return !less(addr, slots_[0].storage_) && less(addr, slots_[N - 1].storage_ + sizeof(Slot));
+    }
+
+    //----------------------------------------------------------------------------------
+    // List whose first N nodes live inside the list object itself.
+    template<typename T, size_t N = 8>
+    using Small_List = List<T, Inline_Allocator<T, N>>;
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,531 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mls
+{
+    //----------------------------------------------------------------------------------
+    // Default capacity keeps a node's payload around a few cache lines.
+    template<typename T>
+    constexpr size_t unrolled_capacity_v = sizeof(T) >= 64 ? 4 : 256 / sizeof(T);
+
+    struct Unrolled_Link
+    {
+        Unrolled_Link* next_;
+        Unrolled_Link* prev_;
+    };
+
+    template<typename T, size_t N>
+    struct Unrolled_Node : Unrolled_Link
+    {
+        size_t count_;
+        alignas(T) unsigned char storage_[N * sizeof(T)];
+
+        Unrolled_Node() : Unrolled_Link{nullptr, nullptr}, count_(0) {}
+        Unrolled_Node(const Unrolled_Node& node) = delete;
+        Unrolled_Node& operator=(const Unrolled_Node& node) = delete;
+
+        T* data() { return std::launder(reinterpret_cast<T*>(storage_)); }
+        T& operator[](size_t i) { return data()[i]; }
+    };
+
+    //----------------------------------------------------------------------------------
+    template<typename T, size_t N, bool IsConst>
+    class Unrolled_Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        Unrolled_Link* node_;
+        size_t idx_;
+
+        Unrolled_Iterator(Unrolled_Link* node, size_t idx) : node_(node), idx_(idx) {}
+        Unrolled_Iterator(const Unrolled_Iterator& it) = default;
+        Unrolled_Iterator& operator=(const Unrolled_Iterator& it) = default;
+        template<bool C = IsConst, typename = std::enable_if_t<C>>
+        Unrolled_Iterator(const Unrolled_Iterator<T, N, false>& it) : node_(it.node_), idx_(it.idx_) {}
+
+        reference operator*() const { return (*as_node())[idx_]; }
+        pointer operator->() const { return &(*as_node())[idx_]; }
+
+        Unrolled_Iterator& operator++() {
+            if(++idx_ == as_node()->count_) {
+                node_ = node_->next_;
+                idx_ = 0;
+            }
+            return *this;
+        }
+        Unrolled_Iterator operator++(int) {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        Unrolled_Iterator& operator--() {
+            if(idx_ == 0) {
+                node_ = node_->prev_;
+                idx_ = as_node()->count_;
+            }
+            --idx_;
+            return *this;
+        }
+        Unrolled_Iterator operator--(int) {
+            auto tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Unrolled_Iterator& it) const { return node_ == it.node_ && idx_ == it.idx_; }
+        bool operator!=(const Unrolled_Iterator& it) const { return !(*this == it); }
+
+    private:
+        Unrolled_Node<T, N>* as_node() const { return static_cast<Unrolled_Node<T, N>*>(node_); }
+    };
+
+    //----------------------------------------------------------------------------------
+    // Doubly-linked list of nodes holding up to N contiguous elements each. Insertion into a
+    // full node splits it in half, erasure merges sparse neighbours, so scans mostly stream
+    // through contiguous memory. Inserting or erasing invalidates iterators into the same node.
+    template<typename T, size_t N = unrolled_capacity_v<T>, typename Allocator = std::allocator<T>>
+    class Unrolled_List
+    {
+        static_assert(N > 0, "Unrolled_List needs at least one element per node");
+
+    private:
+        using Node = Unrolled_Node<T, N>;
+        using Node_Alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using Node_Traits = std::allocator_traits<Node_Alloc>;
+
+    public:
+        using iterator = Unrolled_Iterator<T, N, false>;
+        using const_iterator = Unrolled_Iterator<T, N, true>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        Unrolled_Link fake_node_;
+        Node_Alloc node_alloc_;
+        size_t sz_;
+
+    public:
+        Unrolled_List();
+        explicit Unrolled_List(const Allocator& alloc);
+        Unrolled_List(std::initializer_list<T> init);
+
+        Unrolled_List(const Unrolled_List& copy_list);
+        Unrolled_List(Unrolled_List&& move_list);
+        Unrolled_List& operator=(const Unrolled_List& copy_list);
+        Unrolled_List& operator=(Unrolled_List&& move_list);
+
+        size_t size() const { return sz_; }
+        bool empty() const { return !sz_; }
+        void clear();
+
+        T& front() { return *begin(); }
+        const T& front() const { return *begin(); }
+
+        T& back() { return *(--end()); }
+        const T& back() const { return *(--end()); }
+
+        template<typename U = T>
+        void push_front(U&& el) { emplace_front(std::forward<U>(el)); }
+        template<typename U = T>
+        void push_back(U&& el) { emplace_back(std::forward<U>(el)); }
+
+        template<typename... Args>
+        T& emplace_front(Args&&... args);
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
+
+        void pop_front() { erase(begin()); }
+        void pop_back();
+
+        template<typename U = T>
+        iterator insert(const_iterator it, U&& el) { return emplace(it, std::forward<U>(el)); }
+        template<typename... Args>
+        iterator emplace(const_iterator it, Args&&... args);
+        iterator erase(const_iterator it);
+
+        void swap(Unrolled_List& other);
+
+        iterator begin() { return {fake_node_.next_, 0}; }
+        iterator end() { return {&fake_node_, 0}; }
+
+        const_iterator begin() const { return {fake_node_.next_, 0}; }
+        const_iterator end() const { return {const_cast<Unrolled_Link*>(&fake_node_), 0}; }
+
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        const_reverse_iterator crbegin() const { return rbegin(); }
+        const_reverse_iterator crend() const { return rend(); }
+
+    private:
+        static Node* as_node(Unrolled_Link* link) { return static_cast<Node*>(link); }
+
+        Node* node_construct(Unrolled_Link* next);
+        void node_destruct(Node* del_node);
+
+        // elements go through the allocator too, so e.g. polymorphic_allocator passes itself on
+        template<typename... Args>
+        void el_construct(T* el, Args&&... args) { Node_Traits::construct(node_alloc_, el, std::forward<Args>(args)...); }
+        void el_destruct(T* el) { Node_Traits::destroy(node_alloc_, el); }
+
+        void take_links(Unrolled_List& other) noexcept;
+        void move_elements(Unrolled_List& other);
+        void split(Node* node);
+        void merge_next(Node* node);
+
+    public:
+        ~Unrolled_List();
+    };
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>::Unrolled_List() : fake_node_{&fake_node_, &fake_node_}, node_alloc_(), sz_(0) {}
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>::Unrolled_List(const Allocator& alloc) : fake_node_{&fake_node_, &fake_node_}, node_alloc_(alloc), sz_(0) {}
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>::Unrolled_List(std::initializer_list<T> init) : Unrolled_List()
+    {
+        for (const T& el : init)
+        {
+            push_back(el);
+        }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>::Unrolled_List(const Unrolled_List& copy_list)
+        : Unrolled_List(Allocator(Node_Traits::select_on_container_copy_construction(copy_list.node_alloc_)))
+    {
+        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
+        {
+            push_back(*it);
+        }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>::Unrolled_List(Unrolled_List&& move_list)
+        : fake_node_{&fake_node_, &fake_node_}, node_alloc_(std::move(move_list.node_alloc_)), sz_(0)
+    {
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            take_links(move_list);
+        } else {
+            if(node_alloc_ == move_list.node_alloc_) {
+                take_links(move_list);
+            } else {
+                move_elements(move_list);
+            }
+        }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>& Unrolled_List<T, N, Allocator>::operator=(const Unrolled_List& copy_list)
+    {
+        if(this == &copy_list) { return *this; }
+        if constexpr (Node_Traits::propagate_on_container_copy_assignment::value) {
+            if(node_alloc_ != copy_list.node_alloc_)
+            {
+                clear();
+                node_alloc_ = copy_list.node_alloc_;
+            }
+        }
+        // built with this list's allocator, so the swap below only relinks
+        Unrolled_List tmp((Allocator(node_alloc_)));
+        for (auto it = copy_list.begin(); it != copy_list.end(); ++it)
+        {
+            tmp.push_back(*it);
+        }
+        swap(tmp);
+        return *this;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>& Unrolled_List<T, N, Allocator>::operator=(Unrolled_List&& move_list)
+    {
+        if(this == &move_list) { return *this; }
+        clear();
+        if constexpr (Node_Traits::propagate_on_container_move_assignment::value) {
+            node_alloc_ = std::move(move_list.node_alloc_);
+        } else {
+            if(node_alloc_ != move_list.node_alloc_)
+            {
+                move_elements(move_list);
+                return *this;
+            }
+        }
+        take_links(move_list);
+        return *this;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::take_links(Unrolled_List& other) noexcept
+    {
+        if(other.empty()) { return; }
+        fake_node_ = other.fake_node_;
+        fake_node_.next_->prev_ = &fake_node_;
+        fake_node_.prev_->next_ = &fake_node_;
+
+        other.fake_node_.next_ = &other.fake_node_;
+        other.fake_node_.prev_ = &other.fake_node_;
+        sz_ = std::exchange(other.sz_, 0);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::move_elements(Unrolled_List& other)
+    {
+        for (auto it = other.begin(); it != other.end(); ++it)
+        {
+            emplace_back(std::move(*it));
+        }
+        other.clear();
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::clear()
+    {
+        Unrolled_Link* link = fake_node_.next_;
+        while (link != &fake_node_)
+        {
+            Node* del_node = as_node(link);
+            link = link->next_;
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < del_node->count_; ++i) { el_destruct(del_node->data() + i); }
+            }
+            node_destruct(del_node);
+        }
+        fake_node_.next_ = &fake_node_;
+        fake_node_.prev_ = &fake_node_;
+        sz_ = 0;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    template<typename... Args>
+    T& Unrolled_List<T, N, Allocator>::emplace_front(Args&&... args)
+    {
+        Unrolled_Link* first = fake_node_.next_;
+        if(first == &fake_node_ || as_node(first)->count_ == N)
+        {
+            Node* new_node = node_construct(first);
+            try {
+                el_construct(new_node->data(), std::forward<Args>(args)...);
+            } catch(...) {
+                node_destruct(new_node);
+                throw;
+            }
+            new_node->count_ = 1;
+            ++sz_;
+            return (*new_node)[0];
+        }
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    template<typename... Args>
+    T& Unrolled_List<T, N, Allocator>::emplace_back(Args&&... args)
+    {
+        Unrolled_Link* last = fake_node_.prev_;
+        bool fresh = last == &fake_node_ || as_node(last)->count_ == N;
+        Node* node = fresh ? node_construct(&fake_node_) : as_node(last);
+        try {
+            el_construct(node->data() + node->count_, std::forward<Args>(args)...);
+        } catch(...) {
+            if(fresh) { node_destruct(node); }
+            throw;
+        }
+        ++sz_;
+        return (*node)[node->count_++];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::pop_back()
+    {
+        Node* node = as_node(fake_node_.prev_);
+        el_destruct(node->data() + --node->count_);
+        --sz_;
+        if(!node->count_) { node_destruct(node); }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    template<typename... Args>
+    typename Unrolled_List<T, N, Allocator>::iterator Unrolled_List<T, N, Allocator>::emplace(const_iterator it, Args&&... args)
+    {
+        if(it.node_ == &fake_node_)
+        {
+            emplace_back(std::forward<Args>(args)...);
+            return --end();
+        }
+
+        Node* node = as_node(it.node_);
+        size_t idx = it.idx_;
+
+        // inserting in front of a node's first element can append to a non-full predecessor
+        if(idx == 0 && node->prev_ != &fake_node_ && as_node(node->prev_)->count_ < N)
+        {
+            Node* prev = as_node(node->prev_);
+            el_construct(prev->data() + prev->count_, std::forward<Args>(args)...);
+            ++sz_;
+            return iterator(prev, prev->count_++);
+        }
+
+        T el(std::forward<Args>(args)...);
+        if(node->count_ == N)
+        {
+            split(node);
+            if(idx > node->count_)
+            {
+                idx -= node->count_;
+                node = as_node(node->next_);
+            }
+        }
+
+        T* data = node->data();
+        if(idx == node->count_) {
+            el_construct(data + idx, std::move(el));
+        } else {
+            el_construct(data + node->count_, std::move(data[node->count_ - 1]));
+            for (size_t i = node->count_ - 1; i > idx; --i)
+            {
+                data[i] = std::move(data[i - 1]);
+            }
+            data[idx] = std::move(el);
+        }
+        ++node->count_;
+        ++sz_;
+        return iterator(node, idx);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename Unrolled_List<T, N, Allocator>::iterator Unrolled_List<T, N, Allocator>::erase(const_iterator it)
+    {
+        Node* node = as_node(it.node_);
+        size_t idx = it.idx_;
+
+        T* data = node->data();
+        for (size_t i = idx; i + 1 < node->count_; ++i)
+        {
+            data[i] = std::move(data[i + 1]);
+        }
+        el_destruct(data + --node->count_);
+        --sz_;
+
+        if(!node->count_)
+        {
+            Unrolled_Link* next = node->next_;
+            node_destruct(node);
+            return iterator(next, 0);
+        }
+
+        merge_next(node);
+        if(idx < node->count_) { return iterator(node, idx); }
+        return iterator(node->next_, 0);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::swap(Unrolled_List& other)
+    {
+        if(this == &other) { return; }
+        if constexpr (!Node_Traits::propagate_on_container_swap::value) {
+            // nodes cannot change allocator, so unequal allocators stay put and the elements move
+            if(node_alloc_ != other.node_alloc_)
+            {
+                Unrolled_List tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+                return;
+            }
+        }
+
+        std::swap(fake_node_, other.fake_node_);
+        if constexpr (Node_Traits::propagate_on_container_swap::value) {
+            std::swap(node_alloc_, other.node_alloc_);
+        }
+        std::swap(sz_, other.sz_);
+
+        for (Unrolled_List* list : {this, &other})
+        {
+            Unrolled_Link* fake = &list->fake_node_;
+            if(list->empty()) {
+                fake->next_ = fake;
+                fake->prev_ = fake;
+            } else {
+                fake->next_->prev_ = fake;
+                fake->prev_->next_ = fake;
+            }
+        }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename Unrolled_List<T, N, Allocator>::Node* Unrolled_List<T, N, Allocator>::node_construct(Unrolled_Link* next)
+    {
+        Node* new_node = Node_Traits::allocate(node_alloc_, 1);
+        Node_Traits::construct(node_alloc_, new_node);
+        new_node->next_ = next;
+        new_node->prev_ = next->prev_;
+        next->prev_->next_ = new_node;
+        next->prev_ = new_node;
+        return new_node;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::node_destruct(Node* del_node)
+    {
+        del_node->prev_->next_ = del_node->next_;
+        del_node->next_->prev_ = del_node->prev_;
+        Node_Traits::destroy(node_alloc_, del_node);
+        Node_Traits::deallocate(node_alloc_, del_node, 1);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::split(Node* node)
+    {
+        Node* right = node_construct(node->next_);
+        size_t keep = N / 2;
+        for (size_t i = keep; i < node->count_; ++i)
+        {
+            el_construct(right->data() + right->count_, std::move((*node)[i]));
+            ++right->count_;
+            el_destruct(node->data() + i);
+        }
+        node->count_ = keep;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void Unrolled_List<T, N, Allocator>::merge_next(Node* node)
+    {
+        if(node->count_ >= N / 4 || node->next_ == &fake_node_) { return; }
+        Node* next = as_node(node->next_);
+        if(node->count_ + next->count_ > N) { return; }
+
+        for (size_t i = 0; i < next->count_; ++i)
+        {
+            el_construct(node->data() + node->count_, std::move((*next)[i]));
+            ++node->count_;
+            el_destruct(next->data() + i);
+        }
+        node_destruct(next);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    Unrolled_List<T, N, Allocator>::~Unrolled_List()
+    {
+        clear();
+    }
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,480 @@
+#include "Compact_List.hpp"
+#include "List.hpp"
+#include "Mpsc_List.hpp"
+#include "Pool_Allocator.hpp"
+#include "Unrolled_List.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Every operation runs against mls::List (default and pooled nodes), mls::Unrolled_List,
+// mls::Compact_List and std::list, std::deque and std::vector; sort and merge only where the
+// container can sort. Names read <operation>/<container>/<payload>/<size>, so
+// --benchmark_out_format=json output diffs cleanly between versions. A cold walk over
+// 64-byte payloads follows, and the concurrent benchmarks at the end add the thread count.
+namespace
+{
+    //----------------------------------------------------------------------------------
+    struct Blob
+    {
+        std::array<uint64_t, 8> words_;
+
+        bool operator<(const Blob& other) const { return words_[0] < other.words_[0]; }
+    };
+
+    template<typename T> T make(uint64_t key);
+    template<> int make<int>(uint64_t key) { return static_cast<int>(key); }
+    template<> std::string make<std::string>(uint64_t key) { return "payload-beyond-sso-" + std::to_string(key); }
+    template<> Blob make<Blob>(uint64_t key) { return Blob{{key, key ^ 1, key ^ 2, key ^ 3, key ^ 4, key ^ 5, key ^ 6, key ^ 7}}; }
+
+    uint64_t weight(int value) { return static_cast<uint64_t>(value); }
+    uint64_t weight(const std::string& value) { return value.size(); }
+    uint64_t weight(const Blob& value) { return value.words_[0] + value.words_[7]; }
+
+    std::vector<uint64_t> random_keys(size_t n, uint64_t seed = 42)
+    {
+        std::vector<uint64_t> keys(n);
+        std::mt19937_64 gen(seed);
+        for (auto& key : keys) { key = gen() % (4 * n + 1); }
+        return keys;
+    }
+
+    // Unrolled_List and Compact_List have no value_type of their own
+    template<typename C>
+    using value_of = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<C&>().begin())>>;
+
+    template<typename C>
+    C filled(size_t n, uint64_t seed = 42)
+    {
+        using T = value_of<C>;
+        C c;
+        for (uint64_t key : random_keys(n, seed)) { c.push_back(make<T>(key)); }
+        return c;
+    }
+
+    //----------------------------------------------------------------------------------
+    template<typename C, typename = void>
+    struct is_node_based : std::false_type {};
+    template<typename C>
+    struct is_node_based<C, std::void_t<decltype(std::declval<C&>().splice(std::declval<C&>().end(), std::declval<C&>()))>>
+        : std::true_type {};
+
+    template<typename C>
+    constexpr bool is_sortable_v = is_node_based<C>::value
+        || std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<decltype(std::declval<C&>().begin())>::iterator_category>;
+
+    template<typename C>
+    void sort_all(C& c)
+    {
+        if constexpr (is_node_based<C>::value) {
+            c.sort(std::less<value_of<C>>());
+        } else {
+            std::sort(c.begin(), c.end());
+        }
+    }
+
+    // a and b are sorted; afterwards a holds both and b is empty
+    template<typename C>
+    void merge_all(C& a, C& b)
+    {
+        if constexpr (is_node_based<C>::value) {
+            a.merge(b, std::less<value_of<C>>());
+        } else {
+            size_t mid = a.size();
+            a.insert(a.end(), std::make_move_iterator(b.begin()), std::make_move_iterator(b.end()));
+            b.clear();
+            std::inplace_merge(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(mid), a.end());
+        }
+    }
+
+    //----------------------------------------------------------------------------------
+    template<typename C>
+    void push_back(benchmark::State& state)
+    {
+        using T = value_of<C>;
+        const size_t n = static_cast<size_t>(state.range(0));
+        T value = make<T>(7);
+        for (auto _ : state)
+        {
+            C c;
+            for (size_t i = 0; i < n; ++i) { c.push_back(value); }
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    template<typename C>
+    void push_front(benchmark::State& state)
+    {
+        using T = value_of<C>;
+        const size_t n = static_cast<size_t>(state.range(0));
+        T value = make<T>(7);
+        for (auto _ : state)
+        {
+            C c;
+            for (size_t i = 0; i < n; ++i) { c.insert(c.begin(), value); }
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    template<typename C>
+    void pop_back(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C source = filled<C>(n);
+        C c;
+        for (auto _ : state)
+        {
+            // refill outside the timed region, which also frees the previous round
+            state.PauseTiming();
+            c = source;
+            state.ResumeTiming();
+            while (!c.empty()) { c.pop_back(); }
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    template<typename C>
+    void pop_front(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C source = filled<C>(n);
+        C c;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            c = source;
+            state.ResumeTiming();
+            while (!c.empty()) { c.erase(c.begin()); }
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    // 64 inserts and then 64 erases at a position held in the middle of the container
+    template<typename C>
+    void middle_insert_erase(benchmark::State& state)
+    {
+        using T = value_of<C>;
+        constexpr size_t batch = 64;
+        const size_t n = static_cast<size_t>(state.range(0));
+        C c = filled<C>(n);
+        T value = make<T>(7);
+        for (auto _ : state)
+        {
+            auto mid = std::next(c.begin(), static_cast<std::ptrdiff_t>(n / 2));
+            for (size_t i = 0; i < batch; ++i) { mid = c.insert(mid, value); }
+            for (size_t i = 0; i < batch; ++i) { mid = c.erase(mid); }
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2 * batch));
+    }
+
+    template<typename C>
+    void iterate(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C c = filled<C>(n);
+        for (auto _ : state)
+        {
+            uint64_t sum = 0;
+            for (const auto& el : c) { sum += weight(el); }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    template<typename C>
+    void sort(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C source = filled<C>(n);
+        C c;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            c = source;
+            state.ResumeTiming();
+            sort_all(c);
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    template<typename C>
+    void copy(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C source = filled<C>(n);
+        for (auto _ : state)
+        {
+            C c(source);
+            benchmark::DoNotOptimize(c);
+            state.PauseTiming();
+            c = C();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    // one move construction and one move assignment per iteration
+    template<typename C>
+    void move(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C c = filled<C>(n);
+        for (auto _ : state)
+        {
+            C moved(std::move(c));
+            benchmark::DoNotOptimize(moved);
+            c = std::move(moved);
+        }
+        benchmark::DoNotOptimize(c);
+    }
+
+    template<typename C>
+    void merge(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C left = filled<C>(n / 2, 1);
+        C right = filled<C>(n - n / 2, 2);
+        sort_all(left);
+        sort_all(right);
+        C a;
+        C b;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            a = left;
+            b = right;
+            state.ResumeTiming();
+            merge_all(a, b);
+            benchmark::DoNotOptimize(a);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    template<typename C>
+    void clear(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        C source = filled<C>(n);
+        C c;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            c = source;
+            state.ResumeTiming();
+            c.clear();
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    //----------------------------------------------------------------------------------
+    // Cold traversal: nodes are relinked into random memory order by sorting on random keys,
+    // and each visit does a little work on the payload. range(1) is how far ahead a second
+    // cursor prefetches, 0 is the plain loop. The lead cursor has to chase the same next_
+    // links, so it stalls on the same misses; this is why List's walks do not prefetch.
+    void cold_walk(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        const size_t distance = static_cast<size_t>(state.range(1));
+        mls::List<Blob> list = filled<mls::List<Blob>>(n);
+        list.sort(std::less<Blob>());
+
+        for (auto _ : state)
+        {
+            uint64_t acc = 0;
+            auto lead = list.cbegin();
+            for (size_t i = 0; i < distance && lead != list.cend(); ++i) { ++lead; }
+            for (const Blob& blob : list)
+            {
+                if(distance && lead != list.cend())
+                {
+#if defined(__GNUC__) || defined(__clang__)
+                    __builtin_prefetch(&*lead);
+#endif
+                    ++lead;
+                }
+                for (uint64_t word : blob.words_) { acc = (acc ^ word) * 0x9E3779B97F4A7C15ull; }
+            }
+            benchmark::DoNotOptimize(acc);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    void register_cold_walk()
+    {
+        auto* cold = benchmark::RegisterBenchmark("cold_walk/mls::List/blob64", cold_walk);
+        for (int64_t n : {1 << 16, 1 << 20}) {
+            for (int64_t distance : {0, 4, 8, 16}) { cold->Args({n, distance}); }
+        }
+    }
+
+    //----------------------------------------------------------------------------------
+    // range(0) elements, range(1) threads; 1 thread is the sequential sort
+    void parallel_sort(benchmark::State& state)
+    {
+        const size_t n = static_cast<size_t>(state.range(0));
+        const size_t threads = static_cast<size_t>(state.range(1));
+        mls::List<int> source = filled<mls::List<int>>(n);
+        mls::List<int> c;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            c = source;
+            state.ResumeTiming();
+            c.parallel_sort(std::less<int>(), threads);
+            benchmark::DoNotOptimize(c);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+    }
+
+    // List behind one mutex, the baseline Mpsc_List has to beat
+    struct Locked_List
+    {
+        std::mutex lock_;
+        mls::List<int> list_;
+
+        void push_back(int el)
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            list_.push_back(el);
+        }
+        int pop_front()
+        {
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(lock_);
+                    if(!list_.empty())
+                    {
+                        int el = list_.front();
+                        list_.pop_front();
+                        return el;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    // Thread 0 consumes and every other thread produces. All threads run the same number of
+    // iterations, so the consumer takes one element per producer per iteration and each run
+    // leaves the shared queue empty.
+    template<typename Q>
+    void mpsc(benchmark::State& state)
+    {
+        static Q queue;
+        const int producers = state.threads() - 1;
+        int value = 0;
+        for (auto _ : state)
+        {
+            if(state.thread_index() == 0) {
+                for (int i = 0; i < producers; ++i) { benchmark::DoNotOptimize(queue.pop_front()); }
+            } else {
+                queue.push_back(value++);
+            }
+        }
+        if(state.thread_index() == 0) { state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * producers)); }
+    }
+
+    void register_concurrent()
+    {
+        auto* sorting = benchmark::RegisterBenchmark("parallel_sort/mls::List/int", parallel_sort);
+        for (int64_t threads : {1, 2, 4, 8, 16, 32}) { sorting->Args({1 << 22, threads}); }
+        sorting->UseRealTime();
+
+        auto* unlocked = benchmark::RegisterBenchmark("mpsc/mls::Mpsc_List/int", mpsc<mls::Mpsc_List<int>>);
+        auto* locked = benchmark::RegisterBenchmark("mpsc/mls::List+mutex/int", mpsc<Locked_List>);
+        for (auto* bench : {unlocked, locked})
+        {
+            for (int producers : {1, 2, 4, 8, 16, 32, 64}) { bench->Threads(producers + 1); }
+            bench->UseRealTime();
+        }
+    }
+
+    //----------------------------------------------------------------------------------
+    template<typename T> const char* payload_name();
+    template<> const char* payload_name<int>() { return "int"; }
+    template<> const char* payload_name<std::string>() { return "string"; }
+    template<> const char* payload_name<Blob>() { return "blob64"; }
+
+    using Bench = void (*)(benchmark::State&);
+
+    template<typename C>
+    void register_container(const std::string& container, bool growable_front)
+    {
+        using T = value_of<C>;
+        const std::string suffix = "/" + container + "/" + payload_name<T>();
+        const std::vector<int64_t> sizes = {1 << 10, 1 << 14, 1 << 17};
+        std::vector<int64_t> sort_sizes = {1 << 10, 100000, 1 << 20};
+        // ten million larger payloads would need gigabytes per copy
+        if(std::is_same_v<T, int>) { sort_sizes.push_back(10000000); }
+
+        auto add = [&suffix](const char* op, Bench fn, const std::vector<int64_t>& args) {
+            auto* bench = benchmark::RegisterBenchmark((op + suffix).c_str(), fn);
+            for (int64_t n : args) { bench->Arg(n); }
+            return bench;
+        };
+
+        add("push_back", push_back<C>, sizes);
+        add("pop_back", pop_back<C>, sizes);
+        // front operations are quadratic on std::vector; only the small size says anything there
+        add("push_front", push_front<C>, growable_front ? sizes : std::vector<int64_t>{1 << 10});
+        add("pop_front", pop_front<C>, growable_front ? sizes : std::vector<int64_t>{1 << 10});
+        add("middle_insert_erase", middle_insert_erase<C>, sizes);
+        add("iterate", iterate<C>, sizes);
+        if constexpr (is_sortable_v<C>) { add("sort", sort<C>, sort_sizes); }
+        add("copy", copy<C>, sizes);
+        add("move", move<C>, sizes);
+        if constexpr (is_sortable_v<C>) { add("merge", merge<C>, sizes); }
+        add("clear", clear<C>, sizes);
+    }
+
+    template<typename T>
+    void register_payload()
+    {
+        register_container<mls::List<T>>("mls::List", true);
+        register_container<mls::List<T, mls::Pool_Allocator<T>>>("mls::List+Pool", true);
+        register_container<mls::Unrolled_List<T>>("mls::Unrolled_List", true);
+        register_container<mls::Compact_List<T>>("mls::Compact_List", true);
+        register_container<std::list<T>>("std::list", true);
+        register_container<std::deque<T>>("std::deque", true);
+        register_container<std::vector<T>>("std::vector", false);
+    }
+    //----------------------------------------------------------------------------------
+}
+
+int main(int argc, char** argv)
+{
+    register_payload<int>();
+    register_payload<std::string>();
+    register_payload<Blob>();
+    register_cold_walk();
+    register_concurrent();
+
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
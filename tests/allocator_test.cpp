@@ -0,0 +1,346 @@
+#include "Arena_Allocator.hpp"
+#include "List.hpp"
+#include "Numa_Allocator.hpp"
+#include "Pool_Allocator.hpp"
+#include "Small_List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+using mls_test::same_both_ways;
+
+//----------------------------------------------------------------------------------
+TEST(Pool_Allocator, ReusesFreedSlots)
+{
+    mls::Pool_Allocator<uint64_t, 4> pool;
+    uint64_t* a = pool.allocate(1);
+    uint64_t* b = pool.allocate(1);
+    pool.deallocate(a, 1);
+    EXPECT_EQ(pool.allocate(1), a);
+    EXPECT_NE(b, a);
+    EXPECT_GT(pool.reserved_bytes(), 0u);
+    pool.release();
+    EXPECT_EQ(pool.reserved_bytes(), 0u);
+}
+
+TEST(Pool_Allocator, CopiesStartEmptyAndCompareByIdentity)
+{
+    mls::Pool_Allocator<int> pool;
+    (void)pool.allocate(1);
+    mls::Pool_Allocator<int> copy(pool);
+    EXPECT_EQ(copy.reserved_bytes(), 0u);
+    EXPECT_TRUE(pool == pool);
+    EXPECT_FALSE(pool == copy);
+}
+
+TEST(Pool_Allocator, PooledListBehavesLikeList)
+{
+    Tracked_Scope scope;
+    {
+        mls::List<Tracked, mls::Pool_Allocator<Tracked, 8>> list;
+        for (int i = 0; i < 20; ++i) { list.push_back(Tracked(i)); }
+        list.sort([](const Tracked& a, const Tracked& b) { return b.value_ < a.value_; });
+        EXPECT_EQ(list.front().value_, 19);
+
+        auto moved = std::move(list);
+        EXPECT_EQ(moved.size(), 20u);
+        EXPECT_TRUE(list.empty());
+
+        auto copy = moved;
+        EXPECT_EQ(copy.size(), 20u);
+        copy.clear();
+        EXPECT_EQ(Tracked::live, 20);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+//----------------------------------------------------------------------------------
+TEST(Arena_Allocator, BumpsAndRewinds)
+{
+    mls::Arena_Allocator<uint32_t, 256> arena;
+    uint32_t* a = arena.allocate(1);
+    uint32_t* b = arena.allocate(1);
+    EXPECT_EQ(b, a + 1);
+    arena.release();
+    EXPECT_EQ(arena.allocate(1), a);
+
+    uint32_t* big = arena.allocate(1000);
+    EXPECT_NE(big, nullptr);
+    EXPECT_GE(arena.reserved_bytes(), 1000 * sizeof(uint32_t));
+}
+
+TEST(Arena_Allocator, ClearOfTrivialListRewindsArena)
+{
+    mls::List<int, mls::Arena_Allocator<int, 4096>, mls::Counting_List_Stats> list;
+    for (int i = 0; i < 5000; ++i) { list.push_back(i); }
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.stats().destructs_, 5000u);
+
+    list.push_back(1);
+    EXPECT_EQ(list.front(), 1);
+}
+
+TEST(Arena_Allocator, NonTrivialPayloadIsDestroyed)
+{
+    Tracked_Scope scope;
+    {
+        mls::List<Tracked, mls::Arena_Allocator<Tracked>> list;
+        list.push_back(Tracked(1));
+        list.push_back(Tracked(2));
+        list.pop_front();
+        EXPECT_EQ(Tracked::live, 1);
+        list.clear();
+        EXPECT_EQ(Tracked::live, 0);
+        list.push_back(Tracked(3));
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+//----------------------------------------------------------------------------------
+TEST(Numa_Allocator, ServesPagesAndKeepsPlacement)
+{
+    mls::Numa_Allocator<uint64_t, 16> numa(0);
+    uint64_t* a = numa.allocate(1);
+    *a = 42;
+    EXPECT_EQ(numa.node(), 0);
+    EXPECT_GE(numa.reserved_bytes(), 16 * sizeof(uint64_t));
+    numa.deallocate(a, 1);
+    EXPECT_EQ(numa.allocate(1), a);
+    EXPECT_GE(mls::Numa_Allocator<int>::current_node(), mls::Numa_Allocator<int>::local_node);
+
+    mls::Numa_Allocator<uint64_t, 16> copy(numa);
+    EXPECT_EQ(copy.node(), 0);
+    EXPECT_EQ(copy.reserved_bytes(), 0u);
+}
+
+TEST(Numa_Allocator, ContainerCopiesFollowTheCallingThread)
+{
+    using Numa = mls::Numa_Allocator<int, 64>;
+    Numa pinned(7);
+    EXPECT_EQ(std::allocator_traits<Numa>::select_on_container_copy_construction(pinned).node(), Numa::current_node());
+
+    mls::List<int, Numa> list(Numa(7));
+    for (int i = 0; i < 100; ++i) { list.push_back(i); }
+    int owner = Numa::local_node;
+    int placed = 7;
+    std::thread([&]() {
+        owner = Numa::current_node();
+        list.rehome();
+        placed = list.get_allocator().node();
+    }).join();
+    EXPECT_EQ(placed, owner);
+    EXPECT_EQ(list.size(), 100u);
+    EXPECT_EQ(list.back(), 99);
+}
+
+TEST(Numa_Allocator, RehomeMovesListOntoFreshSlabs)
+{
+    mls::List<int, mls::Numa_Allocator<int, 64>> list;
+    for (int i = 0; i < 1000; ++i) { list.push_back(i); }
+    for (auto it = list.begin(); it != list.end();) { it = (*it % 4) ? list.erase(it) : std::next(it); }
+
+    std::vector<int> expected(list.begin(), list.end());
+    std::thread([&list]() { list.rehome(); }).join();
+    EXPECT_TRUE(same_both_ways(list, expected));
+}
+
+TEST(Pool_Allocator, CompactionPacksNodesAndReturnsSlabs)
+{
+    using Pool_List = mls::List<uint64_t, mls::Pool_Allocator<uint64_t, 256>>;
+    Pool_List list;
+    for (uint64_t i = 0; i < 20000; ++i) { list.push_back(i); }
+    // churn: keep every tenth element and reinsert into the freed slots out of order
+    for (auto it = list.begin(); it != list.end();) { it = (*it % 10) ? list.erase(it) : std::next(it); }
+    for (auto it = list.begin(); it != list.end(); ++it) { it = list.insert(std::next(it), *it + 1); }
+    std::vector<uint64_t> expected(list.begin(), list.end());
+
+    auto adjacent = [&list]() {
+        size_t count = 0;
+        for (auto it = list.begin(), next = std::next(it); next != list.end(); ++it, ++next)
+        {
+            auto gap = reinterpret_cast<const unsigned char*>(&*next) - reinterpret_cast<const unsigned char*>(&*it);
+            if(gap == static_cast<std::ptrdiff_t>(sizeof(mls::List_Node<uint64_t>))) { ++count; }
+        }
+        return count;
+    };
+    size_t adjacent_before = adjacent();
+
+    auto compaction = list.compaction();
+    size_t slices = 1;
+    while (!compaction.step(500)) { ++slices; }
+    EXPECT_GT(slices, 3u);
+    EXPECT_TRUE(same_both_ways(list, expected));
+    EXPECT_GT(compaction.reclaimed(), 0u);
+    EXPECT_GT(adjacent(), expected.size() * 9 / 10);
+    EXPECT_LT(adjacent_before, expected.size() / 2);
+
+    list.push_back(1);
+    list.clear();
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(Pool_Allocator, CompactionWithHandleOutStaysInOwnPool)
+{
+    mls::List<std::string, mls::Pool_Allocator<std::string, 16>> list;
+    for (int i = 0; i < 100; ++i) { list.push_back(std::to_string(i)); }
+    auto handle = list.extract(list.begin());
+    {
+        auto compaction = list.compaction();
+        compaction.finish();
+        EXPECT_EQ(compaction.reclaimed(), 0u);
+    }
+    list.clear();
+    EXPECT_EQ(handle.value(), "0");
+    list.insert(list.end(), std::move(handle));
+    EXPECT_EQ(list.front(), "0");
+}
+
+//----------------------------------------------------------------------------------
+TEST(Small_List, FirstNodesLiveInline)
+{
+    mls::Small_List<int, 4> list = {1, 2, 3};
+
+    auto inside = [&list](const int& el) {
+        auto addr = reinterpret_cast<const unsigned char*>(&el);
+        auto self = reinterpret_cast<const unsigned char*>(&list);
+        return addr >= self && addr < self + sizeof(list);
+    };
+    for (const int& el : list) { EXPECT_TRUE(inside(el)); }
+
+    list.push_back(4);
+    list.push_back(5);
+    EXPECT_FALSE(inside(list.back()));
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(Small_List, RehomeKeepsElementsInOwnStorage)
+{
+    mls::Small_List<std::string, 8> list;
+    for (int i = 0; i < 6; ++i) { list.push_back(std::to_string(i)); }
+    list.erase(std::next(list.begin()));
+    list.rehome();
+    EXPECT_TRUE(same_both_ways(list, std::vector<std::string>{"0", "2", "3", "4", "5"}));
+    list.push_back("6");
+    EXPECT_EQ(list.size(), 6u);
+}
+
+TEST(Small_List, MovesAndSwapsElementWise)
+{
+    using Row = std::vector<int>;
+    static_assert(!std::is_nothrow_move_constructible_v<mls::Small_List<Row>>);
+    mls::Small_List<Row, 2> a = {Row{1}, Row{2, 2}, Row{3, 3, 3}};
+    mls::Small_List<Row, 2> b(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_TRUE(same_both_ways(b, std::vector<Row>{Row{1}, Row{2, 2}, Row{3, 3, 3}}));
+
+    mls::Small_List<Row, 2> c = {Row{9}};
+    c.swap(b);
+    EXPECT_TRUE(same_both_ways(c, std::vector<Row>{Row{1}, Row{2, 2}, Row{3, 3, 3}}));
+    EXPECT_TRUE(same_both_ways(b, std::vector<Row>{Row{9}}));
+
+    b = c;
+    EXPECT_TRUE(same_both_ways(b, std::vector<Row>{Row{1}, Row{2, 2}, Row{3, 3, 3}}));
+}
+
+//----------------------------------------------------------------------------------
+// clear() on a bulk-release list must not free the slot an extracted handle still owns
+template<typename Alloc>
+class Extract_Then_Clear : public testing::Test {};
+
+using Bulk_Allocators = testing::Types<mls::Pool_Allocator<int, 16>, mls::Arena_Allocator<int, 1024>, mls::Numa_Allocator<int, 16>>;
+TYPED_TEST_SUITE(Extract_Then_Clear, Bulk_Allocators);
+
+TYPED_TEST(Extract_Then_Clear, HandleSurvivesClear)
+{
+    mls::List<int, TypeParam> list;
+    for (int i = 0; i < 100; ++i) { list.push_back(i); }
+    auto handle = list.extract(std::next(list.begin(), 42));
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(handle.value(), 42);
+
+    list.push_back(7);
+    list.insert(list.begin(), std::move(handle));
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{42, 7}));
+}
+
+TYPED_TEST(Extract_Then_Clear, DroppedHandleReenablesBulkRelease)
+{
+    mls::List<int, TypeParam> list = {1, 2, 3};
+    {
+        auto handle = list.extract(list.begin());
+        list.clear();
+        EXPECT_EQ(handle.value(), 1);
+    }
+    list = {4, 5};
+    auto handle = list.extract(list.begin());
+    list.insert(list.end(), std::move(handle));
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{5, 4}));
+    list.clear();
+    list.push_back(6);
+    EXPECT_EQ(list.front(), 6);
+}
+
+TYPED_TEST(Extract_Then_Clear, HandleSurvivesCompact)
+{
+    mls::List<int, TypeParam> list;
+    for (int i = 0; i < 100; ++i) { list.push_back(i); }
+    auto handle = list.extract(list.begin());
+    list.compact();
+    list.clear();
+    EXPECT_EQ(handle.value(), 0);
+
+    list.push_back(1);
+    list.insert(list.begin(), std::move(handle));
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{0, 1}));
+}
+
+TYPED_TEST(Extract_Then_Clear, HandleFollowsMovedList)
+{
+    mls::List<int, TypeParam> list;
+    for (int i = 0; i < 100; ++i) { list.push_back(i); }
+    auto handle = list.extract(list.begin());
+    mls::List<int, TypeParam> moved(std::move(list));
+    moved.clear();
+    EXPECT_EQ(handle.value(), 0);
+
+    mls::List<int, TypeParam> assigned = {5, 6};
+    assigned = std::move(moved);
+    assigned.clear();
+    EXPECT_EQ(handle.value(), 0);
+
+    mls::List<int, TypeParam> swapped = {7};
+    swapped.swap(assigned);
+    swapped.clear();
+    EXPECT_EQ(handle.value(), 0);
+
+    // the handle's node still belongs to swapped's allocator, so it relinks without a copy
+    const int* address = &handle.value();
+    swapped.insert(swapped.end(), std::move(handle));
+    EXPECT_EQ(&swapped.front(), address);
+    EXPECT_TRUE(same_both_ways(assigned, std::vector<int>{7}));
+}
+
+TEST(Pool_Allocator, HandleInsertedIntoAnotherPoolReallocates)
+{
+    mls::List<std::string, mls::Pool_Allocator<std::string>> a = {"moved"};
+    mls::List<std::string, mls::Pool_Allocator<std::string>> b;
+    const std::string* old_address = &a.front();
+    auto handle = a.extract(a.begin());
+    b.insert(b.end(), std::move(handle));
+    EXPECT_TRUE(handle.empty());
+    EXPECT_EQ(b.front(), "moved");
+    EXPECT_NE(&b.front(), old_address);
+}
@@ -0,0 +1,86 @@
+#include "Bounded_List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+using mls_test::to_vector;
+
+//----------------------------------------------------------------------------------
+TEST(Bounded_List, RejectsOrTimesOutWhenFull)
+{
+    mls::Bounded_List<int> queue(2);
+    EXPECT_TRUE(queue.try_push_back(1));
+    EXPECT_TRUE(queue.push_back(2, std::chrono::milliseconds(1)));
+    EXPECT_FALSE(queue.try_push_back(3));
+    EXPECT_FALSE(queue.push_back(3, std::chrono::milliseconds(5)));
+    EXPECT_EQ(queue.size(), 2u);
+
+    int out = 0;
+    EXPECT_TRUE(queue.try_pop_front(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(queue.pop_front(out, std::chrono::milliseconds(1)));
+    EXPECT_EQ(out, 2);
+    EXPECT_FALSE(queue.pop_front(out, std::chrono::milliseconds(5)));
+}
+
+TEST(Bounded_List, EvictDropsOldest)
+{
+    mls::Bounded_List<int> queue(3);
+    for (int value : {1, 2, 3}) { EXPECT_FALSE(queue.push_back_evict(value)); }
+    EXPECT_TRUE(queue.push_back_evict(4));
+    EXPECT_TRUE(queue.push_back_evict(5));
+
+    mls::List<int> out;
+    EXPECT_EQ(queue.drain(out), 3u);
+    EXPECT_EQ(to_vector(out), (std::vector<int>{3, 4, 5}));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(Bounded_List, ThrowingEvictLeavesQueueUnchanged)
+{
+    Tracked_Scope scope;
+    {
+        mls::Bounded_List<Tracked> queue(3);
+        for (int i = 1; i <= 3; ++i) { queue.push_back_evict(Tracked(i)); }
+
+        Tracked next(4);
+        Tracked::budget = 0;
+        EXPECT_THROW(queue.push_back_evict(next), std::runtime_error);
+        Tracked::budget = -1;
+        EXPECT_EQ(queue.size(), 3u);
+
+        // a move cannot throw, so this one recycles the oldest node
+        EXPECT_TRUE(queue.push_back_evict(std::move(next)));
+        mls::List<Tracked> out;
+        queue.drain(out);
+        std::vector<int> values;
+        for (const Tracked& el : out) { values.push_back(el.value_); }
+        EXPECT_EQ(values, (std::vector<int>{2, 3, 4}));
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Bounded_List, BlockedProducerResumesAfterDrain)
+{
+    mls::Bounded_List<int> queue(1);
+    ASSERT_TRUE(queue.try_push_back(1));
+
+    bool pushed = false;
+    std::thread producer([&]() { pushed = queue.push_back(2, std::chrono::seconds(10)); });
+    mls::List<int> out;
+    while (out.size() < 2)
+    {
+        queue.drain(out);
+        std::this_thread::yield();
+    }
+    producer.join();
+    EXPECT_TRUE(pushed);
+    EXPECT_EQ(to_vector(out), (std::vector<int>{1, 2}));
+}
@@ -0,0 +1,165 @@
+#include "Compact_List.hpp"
+#include "List_Snapshot.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+using mls_test::same_both_ways;
+
+//----------------------------------------------------------------------------------
+TEST(Compact_List, LinksAreNarrowIndices)
+{
+    EXPECT_EQ(sizeof(mls::Compact_Node<uint32_t, uint32_t>), 12u);
+    EXPECT_EQ(sizeof(mls::Compact_Node<uint16_t, uint16_t>), 6u);
+    EXPECT_EQ((mls::Compact_List<int, uint8_t>::max_size()), 255u);
+}
+
+TEST(Compact_List, EditsReuseFreedSlots)
+{
+    mls::Compact_List<int> list = {1, 2, 3, 4};
+    list.erase(std::next(list.begin()));
+    list.insert(list.begin(), 0);
+    list.push_back(5);
+    list.pop_front();
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{1, 3, 4, 5}));
+
+    list.reserve(100);
+    EXPECT_GE(list.capacity(), 100u);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{1, 3, 4, 5}));
+}
+
+TEST(Compact_List, IndexSpaceExhaustionThrows)
+{
+    mls::Compact_List<int, uint8_t> list;
+    for (int i = 0; i < 254; ++i) { list.push_back(i); }
+    EXPECT_THROW(list.push_back(0), std::length_error);
+    EXPECT_EQ(list.size(), 254u);
+    EXPECT_EQ(list.back(), 253);
+}
+
+TEST(Compact_List, GrowthMovesNonTrivialPayload)
+{
+    Tracked_Scope scope;
+    {
+        mls::Compact_List<Tracked> list;
+        for (int i = 0; i < 100; ++i) { list.emplace_back(i); }
+        mls::Compact_List<Tracked> copy(list);
+        EXPECT_EQ(Tracked::live, 200);
+        EXPECT_EQ(copy.back().value_, 99);
+        copy = std::move(list);
+        EXPECT_EQ(Tracked::live, 100);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Compact_List, PolymorphicAllocatorMovesAndSwaps)
+{
+    std::pmr::monotonic_buffer_resource pool;
+    std::pmr::monotonic_buffer_resource other_pool;
+    using Pmr_List = mls::Compact_List<int, uint32_t, std::pmr::polymorphic_allocator<int>>;
+    Pmr_List list(&pool);
+    for (int i = 0; i < 40; ++i) { list.push_back(i); }
+
+    Pmr_List moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.size(), 40u);
+
+    Pmr_List assigned(&other_pool);
+    assigned.push_back(-1);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 40u);
+    EXPECT_EQ(assigned.back(), 39);
+
+    Pmr_List small(&pool);
+    small.push_back(7);
+    small.swap(assigned);
+    EXPECT_EQ(small.size(), 40u);
+    EXPECT_TRUE(same_both_ways(assigned, std::vector<int>{7}));
+
+    Pmr_List copy(small);
+    copy = assigned;
+    EXPECT_TRUE(same_both_ways(copy, std::vector<int>{7}));
+    small.push_back(40);
+    EXPECT_EQ(small.back(), 40);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List_Snapshot, RoundTripsThroughFile)
+{
+    mls::List<uint64_t> list;
+    for (uint64_t i = 0; i < 5000; ++i) { list.push_back(i * 3); }
+
+    std::string path = testing::TempDir() + "list_snapshot_" + std::to_string(::getpid()) + ".bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        mls::serialize(list, out);
+    }
+
+    auto view = mls::load_mmap<uint64_t>(path);
+    EXPECT_EQ(view.size(), list.size());
+    EXPECT_EQ(view.front(), 0u);
+    EXPECT_EQ(view.back(), 4999u * 3);
+    EXPECT_TRUE(std::equal(view.begin(), view.end(), list.begin(), list.end()));
+
+    mls::List<uint64_t> copy = view.to_list();
+    EXPECT_TRUE(same_both_ways(copy, std::vector<uint64_t>(list.begin(), list.end())));
+    std::remove(path.c_str());
+}
+
+TEST(List_Snapshot, RejectsForeignFiles)
+{
+    std::string path = testing::TempDir() + "not_a_snapshot_" + std::to_string(::getpid()) + ".bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(256, 'x');
+    }
+    EXPECT_THROW(mls::load_mmap<uint64_t>(path), std::runtime_error);
+    EXPECT_THROW(mls::load_mmap<uint64_t>(path + ".missing"), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(List_Snapshot, RejectsCorruptLinks)
+{
+    using Node = mls::Compact_Node<uint64_t, uint32_t>;
+    mls::List<uint64_t> list{1, 2, 3, 4, 5, 6, 7, 8};
+    std::string path = testing::TempDir() + "corrupt_snapshot_" + std::to_string(::getpid()) + ".bin";
+    std::string bytes;
+    {
+        std::ostringstream out(std::ios::binary);
+        mls::serialize(list, out);
+        bytes = out.str();
+    }
+
+    auto write_with = [&](size_t record, size_t field, uint32_t link) {
+        std::string patched = bytes;
+        std::memcpy(&patched[mls::snapshot_offset_v<uint64_t> + record * sizeof(Node) + field], &link, sizeof(link));
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(patched.data(), static_cast<std::streamsize>(patched.size()));
+    };
+
+    write_with(3, offsetof(Node, next_), 4);
+    EXPECT_EQ(mls::load_mmap<uint64_t>(path).size(), list.size());
+
+    write_with(3, offsetof(Node, next_), 1000);
+    EXPECT_THROW(mls::load_mmap<uint64_t>(path), std::runtime_error);
+    write_with(5, offsetof(Node, prev_), 2);
+    EXPECT_THROW(mls::load_mmap<uint64_t>(path), std::runtime_error);
+    write_with(8, offsetof(Node, next_), 1);
+    EXPECT_THROW(mls::load_mmap<uint64_t>(path), std::runtime_error);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,196 @@
+#include "Concurrent_List.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::atomic<long> live_nodes{0};
+
+    // Thread-safe allocator that counts the nodes it has handed out and not yet taken back.
+    template<typename T>
+    struct Counting_Allocator
+    {
+        using value_type = T;
+
+        Counting_Allocator() = default;
+        template<typename U>
+        Counting_Allocator(const Counting_Allocator<U>&) noexcept {}
+
+        T* allocate(size_t n)
+        {
+            live_nodes.fetch_add(static_cast<long>(n));
+            return std::allocator<T>().allocate(n);
+        }
+        void deallocate(T* p, size_t n) noexcept
+        {
+            live_nodes.fetch_sub(static_cast<long>(n));
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template<typename U>
+        bool operator==(const Counting_Allocator<U>&) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const Counting_Allocator<U>&) const noexcept { return false; }
+    };
+}
+
+//----------------------------------------------------------------------------------
+TEST(Concurrent_List, OrderedSetSemantics)
+{
+    mls::Concurrent_List<int> list;
+    EXPECT_TRUE(list.insert(3));
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_TRUE(list.insert(2));
+    EXPECT_FALSE(list.insert(2));
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_TRUE(list.contains(2));
+
+    {
+        auto reader = list.read();
+        std::vector<int> seen(reader.begin(), reader.end());
+        EXPECT_EQ(seen, (std::vector<int>{1, 2, 3}));
+    }
+
+    EXPECT_TRUE(list.erase(2));
+    EXPECT_FALSE(list.erase(2));
+    EXPECT_FALSE(list.contains(2));
+    EXPECT_EQ(list.size(), 2u);
+
+    {
+        auto reader = list.read();
+        EXPECT_TRUE(list.erase(reader.begin()));
+    }
+    EXPECT_FALSE(list.contains(1));
+    EXPECT_EQ(list.size(), 1u);
+}
+
+TEST(Concurrent_List, OverlappingReadersDoNotPinRetiredNodes)
+{
+    using Counted = Counting_Allocator<int>;
+    {
+        mls::Concurrent_List<int, std::less<int>, Counted> list;
+        for (int i = 0; i < 10; ++i) { list.insert(i); }
+
+        auto first = std::make_unique<mls::Concurrent_List<int, std::less<int>, Counted>::Reader>(list.read());
+        list.erase(0);
+        list.erase(1);
+        EXPECT_EQ(live_nodes, 10);
+
+        // a reader arriving before the old one leaves keeps the list from ever going quiet
+        auto second = list.read();
+        first.reset();
+        list.erase(2);
+        EXPECT_LT(live_nodes, 10);
+        EXPECT_EQ(list.size(), 7u);
+        for (int v : second) { EXPECT_GE(v, 3); }
+    }
+    EXPECT_EQ(live_nodes, 0);
+
+    {
+        mls::Concurrent_List<int, std::less<int>, Counted> list;
+        list.insert(1);
+        list.erase(1);
+        EXPECT_EQ(live_nodes, 0);
+    }
+}
+
+TEST(Concurrent_List, ConcurrentInsertEraseKeepsOrder)
+{
+    constexpr int threads = 4;
+    constexpr int per_thread = 2000;
+    mls::Concurrent_List<int> list;
+    std::atomic<bool> done{false};
+
+    std::thread reader_thread([&]() {
+        while (!done.load())
+        {
+            auto reader = list.read();
+            int prev = -1;
+            for (int v : reader)
+            {
+                ASSERT_LT(prev, v);
+                prev = v;
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; ++t)
+    {
+        writers.emplace_back([&list, t]() {
+            for (int i = 0; i < per_thread; ++i) { list.insert(i * threads + t); }
+            for (int i = 0; i < per_thread; i += 2) { list.erase(i * threads + t); }
+        });
+    }
+    for (auto& writer : writers) { writer.join(); }
+    done.store(true);
+    reader_thread.join();
+
+    EXPECT_EQ(list.size(), static_cast<size_t>(threads * per_thread / 2));
+    for (int v = 0; v < threads * per_thread; ++v)
+    {
+        ASSERT_EQ(list.contains(v), (v / threads) % 2 == 1);
+    }
+}
+
+TEST(Concurrent_List, StringPayloadSurvivesChurn)
+{
+    mls::Concurrent_List<std::string> list;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 3; ++t)
+    {
+        workers.emplace_back([&list, t]() {
+            for (int i = 0; i < 1000; ++i)
+            {
+                std::string key = "key-that-is-not-short-" + std::to_string(i % 50);
+                if((i + t) % 2) {
+                    list.insert(key);
+                } else {
+                    list.erase(key);
+                }
+                (void)list.contains(key);
+            }
+        });
+    }
+    for (auto& worker : workers) { worker.join(); }
+    auto reader = list.read();
+    size_t count = 0;
+    for (auto it = reader.begin(); it != reader.end(); ++it) { ++count; }
+    EXPECT_EQ(count, list.size());
+}
+
+TEST(Concurrent_List, NeighbourErasesKeepBothLinkDirections)
+{
+    constexpr int n = 4000;
+    mls::Concurrent_List<int> list;
+    for (int i = 0; i < n; ++i) { list.insert(i); }
+
+    // adjacent keys go to different threads, so an erase often races with its neighbour's
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 2; ++t)
+    {
+        workers.emplace_back([&list, t]() {
+            for (int i = t; i < n; i += 2)
+            {
+                if(i % 3) { list.erase(i); }
+            }
+        });
+    }
+    for (auto& worker : workers) { worker.join(); }
+
+    auto reader = list.read();
+    std::vector<int> forward(reader.begin(), reader.end());
+    std::vector<int> backward;
+    for (auto it = reader.end(); it != reader.begin();) { backward.push_back(*--it); }
+    std::vector<int> expected;
+    for (int i = 0; i < n; i += 3) { expected.push_back(i); }
+    EXPECT_EQ(forward, expected);
+    EXPECT_EQ(std::vector<int>(backward.rbegin(), backward.rend()), expected);
+}
@@ -0,0 +1,179 @@
+#include "Indexed_List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using mls_test::same_both_ways;
+
+namespace
+{
+    // Counts the construct/destroy calls that reach it through allocator_traits.
+    template<typename T>
+    struct Observed_Allocator : std::allocator<T>
+    {
+        static inline int constructs = 0;
+        static inline int destroys = 0;
+
+        template<typename U>
+        struct rebind { using other = Observed_Allocator<U>; };
+
+        Observed_Allocator() = default;
+        template<typename U>
+        Observed_Allocator(const Observed_Allocator<U>&) noexcept {}
+
+        template<typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ++constructs;
+            ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+        template<typename U>
+        void destroy(U* p)
+        {
+            ++destroys;
+            p->~U();
+        }
+    };
+}
+
+//----------------------------------------------------------------------------------
+TEST(Indexed_List, PositionalAccessFollowsEdits)
+{
+    mls::Indexed_List<int> list;
+    std::vector<int> model;
+    std::mt19937 gen(5);
+
+    for (int step = 0; step < 3000; ++step)
+    {
+        size_t pos = model.empty() ? 0 : gen() % (model.size() + 1);
+        if(model.empty() || gen() % 4) {
+            list.insert(list.nth(pos), step);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(pos), step);
+        } else {
+            pos %= model.size();
+            list.erase(list.nth(pos));
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+    }
+
+    ASSERT_TRUE(same_both_ways(list, model));
+    for (size_t i = 0; i < model.size(); i += 37)
+    {
+        EXPECT_EQ(list[i], model[i]);
+        EXPECT_EQ(list.index_of(list.nth(i)), i);
+    }
+    EXPECT_EQ(list.nth(model.size()), list.end());
+    EXPECT_THROW(list.at(model.size()), std::out_of_range);
+}
+
+TEST(Indexed_List, FindReturnsFirstInListOrder)
+{
+    mls::Indexed_List<std::string> list = {"b", "a", "c", "a"};
+    auto found = list.find("a");
+    ASSERT_NE(found, list.end());
+    EXPECT_EQ(list.index_of(found), 1u);
+
+    list.erase(found);
+    EXPECT_EQ(list.index_of(list.find("a")), 2u);
+    EXPECT_EQ(list.find("z"), list.end());
+
+    list.push_front("a");
+    EXPECT_EQ(list.index_of(list.find("a")), 0u);
+}
+
+TEST(Indexed_List, CopyAndMoveKeepIndex)
+{
+    mls::Indexed_List<int> list = {4, 5, 6};
+    mls::Indexed_List<int> copy(list);
+    mls::Indexed_List<int> moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(copy.index_of(copy.find(6)), 2u);
+    EXPECT_EQ(moved[1], 5);
+
+    moved.pop_front();
+    moved.pop_back();
+    EXPECT_TRUE(same_both_ways(moved, std::vector<int>{5}));
+    copy.clear();
+    EXPECT_EQ(copy.find(4), copy.end());
+}
+
+TEST(Indexed_List, NodesGoThroughAllocatorTraits)
+{
+    using Alloc = Observed_Allocator<std::string>;
+    using Node_Alloc = std::allocator_traits<Alloc>::rebind_alloc<mls::Indexed_Node<std::string>>;
+    Node_Alloc::constructs = 0;
+    Node_Alloc::destroys = 0;
+    {
+        mls::Indexed_List<std::string, std::hash<std::string>, std::equal_to<std::string>, Alloc> list;
+        list.push_back("a");
+        list.push_back("b");
+        list.push_front("c");
+        list.erase(list.nth(1));
+        // the node and then its payload, so the allocator reaches T itself
+        EXPECT_EQ(Node_Alloc::constructs, 6);
+        EXPECT_EQ(Node_Alloc::destroys, 1);
+    }
+    EXPECT_EQ(Node_Alloc::destroys, 3);
+}
+
+TEST(Indexed_List, ManyEqualElementsEraseDirectly)
+{
+    mls::Indexed_List<int> list;
+    for (int i = 0; i < 2000; ++i) { list.push_back(i % 3 ? 7 : i); }
+    while (list.size() > 700) { list.erase(list.nth(list.size() / 2)); }
+
+    std::vector<int> model(list.begin(), list.end());
+    size_t first_seven = static_cast<size_t>(std::find(model.begin(), model.end(), 7) - model.begin());
+    EXPECT_EQ(list.index_of(list.find(7)), first_seven);
+    list.erase(list.find(7));
+    model.erase(model.begin() + static_cast<std::ptrdiff_t>(first_seven));
+    EXPECT_TRUE(same_both_ways(list, model));
+
+    for (auto it = list.begin(); it != list.end();) { it = *it == 7 ? list.erase(it) : std::next(it); }
+    EXPECT_EQ(list.find(7), list.end());
+    EXPECT_EQ(list.index_of(list.find(0)), 0u);
+}
+
+TEST(Indexed_List, PolymorphicAllocatorMovesAndSwaps)
+{
+    std::pmr::monotonic_buffer_resource pool;
+    std::pmr::monotonic_buffer_resource other_pool;
+    using Pmr_List = mls::Indexed_List<std::pmr::string, std::hash<std::pmr::string>, std::equal_to<std::pmr::string>,
+                                       std::pmr::polymorphic_allocator<std::pmr::string>>;
+    Pmr_List list(&pool);
+    for (int i = 0; i < 10; ++i) { list.push_back(std::pmr::string(40, static_cast<char>('a' + i))); }
+    for (const auto& el : list) { ASSERT_EQ(el.get_allocator().resource(), &pool); }
+
+    Pmr_List moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.index_of(moved.find(std::pmr::string(40, 'c'))), 2u);
+
+    Pmr_List assigned(&other_pool);
+    assigned = std::move(moved);
+    for (const auto& el : assigned) { ASSERT_EQ(el.get_allocator().resource(), &other_pool); }
+    EXPECT_EQ(assigned.index_of(assigned.find(std::pmr::string(40, 'j'))), 9u);
+
+    Pmr_List small(&pool);
+    small.push_back("x");
+    small.swap(assigned);
+    EXPECT_EQ(small.size(), 10u);
+    EXPECT_EQ(assigned.index_of(assigned.find("x")), 0u);
+    for (const auto& el : small) { ASSERT_EQ(el.get_allocator().resource(), &pool); }
+
+    Pmr_List copy(small);
+    EXPECT_EQ(copy.front().get_allocator().resource(), std::pmr::get_default_resource());
+    copy = assigned;
+    EXPECT_TRUE(same_both_ways(copy, std::vector<std::pmr::string>{"x"}));
+}
@@ -0,0 +1,122 @@
+#include "Intrusive_List.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Task
+    {
+        std::string name_;
+        mls::List_Hook run_hook_;
+        int priority_;
+        mls::List_Hook wait_hook_;
+
+        explicit Task(std::string name, int priority = 0) : name_(std::move(name)), run_hook_(), priority_(priority), wait_hook_() {}
+    };
+
+    // hook behind a vtable pointer and a large payload, in a type with no default constructor
+    struct Widget
+    {
+        char payload_[200];
+        mls::List_Hook hook_;
+        int id_;
+
+        explicit Widget(int id) : payload_(), hook_(), id_(id) {}
+        virtual ~Widget() = default;
+    };
+
+    using Run_List = mls::Intrusive_List<Task, &Task::run_hook_>;
+    using Wait_List = mls::Intrusive_List<Task, &Task::wait_hook_>;
+
+    std::vector<std::string> names(const Run_List& list)
+    {
+        std::vector<std::string> out;
+        for (const Task& task : list) { out.push_back(task.name_); }
+        return out;
+    }
+}
+
+//----------------------------------------------------------------------------------
+TEST(Intrusive_List, LinksObjectsWithoutCopies)
+{
+    Task a("a");
+    Task b("b");
+    Task c("c");
+    Run_List list;
+    list.push_back(b);
+    list.push_front(a);
+    list.push_back(c);
+
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_EQ(&list.front(), &a);
+    EXPECT_EQ(&list.back(), &c);
+    EXPECT_EQ(names(list), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_TRUE(b.run_hook_.is_linked());
+
+    list.unlink(b);
+    EXPECT_FALSE(b.run_hook_.is_linked());
+    EXPECT_EQ(names(list), (std::vector<std::string>{"a", "c"}));
+    list.clear();
+    EXPECT_FALSE(a.run_hook_.is_linked());
+}
+
+TEST(Intrusive_List, ObjectSitsOnTwoListsAtOnce)
+{
+    Task a("a", 1);
+    Task b("b", 2);
+    Run_List run;
+    Wait_List wait;
+    run.push_back(a);
+    run.push_back(b);
+    wait.push_back(b);
+    wait.push_back(a);
+
+    EXPECT_EQ(&*Wait_List::iterator_to(b), &b);
+    EXPECT_EQ(wait.front().priority_, 2);
+    EXPECT_EQ(run.front().priority_, 1);
+
+    auto it = wait.erase(wait.begin());
+    EXPECT_EQ(&*it, &a);
+    EXPECT_EQ(run.size(), 2u);
+    wait.clear();
+    run.clear();
+}
+
+TEST(Intrusive_List, MoveAndSwapRelinkSentinels)
+{
+    Task a("a");
+    Task b("b");
+    Run_List first;
+    first.push_back(a);
+    Run_List second(std::move(first));
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(&second.front(), &a);
+
+    first.push_back(b);
+    first.swap(second);
+    EXPECT_EQ(&first.front(), &a);
+    EXPECT_EQ(&second.back(), &b);
+    EXPECT_EQ(&*second.rbegin(), &b);
+    first.clear();
+    second.clear();
+}
+
+TEST(Intrusive_List, HookOffsetMatchesTheMember)
+{
+    using Traits = mls::Hook_Traits<Task, &Task::wait_hook_>;
+    Task task("t");
+    EXPECT_EQ(Traits::offset(), reinterpret_cast<char*>(&task.wait_hook_) - reinterpret_cast<char*>(&task));
+    EXPECT_EQ(Traits::to_owner(&task.wait_hook_), &task);
+
+    Widget a(1);
+    Widget b(2);
+    mls::Intrusive_List<Widget, &Widget::hook_> list;
+    list.push_back(a);
+    list.push_back(b);
+    EXPECT_EQ(&list.front(), &a);
+    EXPECT_EQ(list.back().id_, 2);
+    list.clear();
+}
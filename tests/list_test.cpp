@@ -0,0 +1,673 @@
+#include "List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<ranges>)
+#include <ranges>
+#endif
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+using mls_test::same_both_ways;
+using mls_test::to_vector;
+
+namespace
+{
+    struct Keyed
+    {
+        int key_;
+        int seq_;
+    };
+
+    struct No_Default
+    {
+        int value_;
+
+        explicit No_Default(int value) : value_(value) {}
+        No_Default(const No_Default&) = default;
+    };
+
+    struct Two_Args
+    {
+        std::string name_;
+        int count_;
+
+        Two_Args(std::string name, int count) : name_(std::move(name)), count_(count) {}
+        Two_Args(const Two_Args&) = delete;
+        Two_Args(Two_Args&&) = delete;
+    };
+
+    // Forwards to upstream until left_ allocations have been served, then throws.
+    struct Limited_Resource : std::pmr::memory_resource
+    {
+        std::pmr::memory_resource* upstream_;
+        long left_ = -1;
+
+        explicit Limited_Resource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+        void* do_allocate(size_t bytes, size_t align) override
+        {
+            if(left_ == 0) { throw std::bad_alloc(); }
+            if(left_ > 0) { --left_; }
+            return upstream_->allocate(bytes, align);
+        }
+        void do_deallocate(void* p, size_t bytes, size_t align) override { upstream_->deallocate(p, bytes, align); }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    std::vector<int> shuffled(size_t n, unsigned seed = 7)
+    {
+        std::vector<int> values(n);
+        std::iota(values.begin(), values.end(), 0);
+        std::shuffle(values.begin(), values.end(), std::mt19937(seed));
+        return values;
+    }
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, SortOrdersAndKeepsLinksConsistent)
+{
+    std::vector<int> values = shuffled(1000);
+    mls::List<int> list;
+    for (int v : values) { list.push_back(v); }
+    list.sort();
+    std::sort(values.begin(), values.end());
+    EXPECT_TRUE(same_both_ways(list, values));
+
+    list.sort(false);
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    EXPECT_TRUE(same_both_ways(list, values));
+}
+
+TEST(List, SortIsStable)
+{
+    mls::List<Keyed> list;
+    std::mt19937 gen(3);
+    for (int i = 0; i < 500; ++i) { list.push_back(Keyed{static_cast<int>(gen() % 10), i}); }
+    list.sort([](const Keyed& a, const Keyed& b) { return a.key_ < b.key_; });
+
+    const Keyed* prev = nullptr;
+    for (const Keyed& el : list)
+    {
+        if(prev) {
+            ASSERT_LE(prev->key_, el.key_);
+            if(prev->key_ == el.key_) { ASSERT_LT(prev->seq_, el.seq_); }
+        }
+        prev = &el;
+    }
+}
+
+TEST(List, SortKeepsNodesInPlace)
+{
+    mls::List<int> list;
+    for (int v : {3, 1, 2}) { list.push_back(v); }
+    const int* one = &*std::next(list.begin());
+    list.sort();
+    EXPECT_EQ(&list.front(), one);
+}
+
+TEST(List, SortThrowingComparatorKeepsEveryNode)
+{
+    Tracked_Scope scope;
+    std::vector<int> values = shuffled(300);
+    for (long budget : {0L, 1L, 150L, 1000L, 2000L})
+    {
+        mls::List<Tracked> list(values.begin(), values.end());
+        Tracked::budget = budget;
+        EXPECT_THROW(list.sort(), std::runtime_error);
+        Tracked::budget = -1;
+
+        EXPECT_EQ(Tracked::live, 300);
+        std::vector<int> seen;
+        for (const Tracked& el : list) { seen.push_back(el.value_); }
+        EXPECT_EQ(seen.size(), list.size());
+        EXPECT_TRUE(std::is_permutation(seen.begin(), seen.end(), values.begin(), values.end()));
+        EXPECT_EQ(std::distance(list.rbegin(), list.rend()), 300);
+
+        list.sort();
+        EXPECT_EQ(list.front().value_, 0);
+        EXPECT_EQ(list.back().value_, 299);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, EmplaceConstructsInPlace)
+{
+    mls::List<Two_Args> list;
+    list.emplace_back("b", 2);
+    list.emplace_front("a", 1);
+    auto it = list.emplace(list.end(), "c", 3);
+    EXPECT_EQ(it->name_, "c");
+    EXPECT_EQ(list.front().count_, 1);
+    EXPECT_EQ(list.back().count_, 3);
+    EXPECT_EQ(list.size(), 3u);
+}
+
+TEST(List, PushForwardsRvalues)
+{
+    mls::List<std::vector<int>> list;
+    std::vector<int> value(64, 1);
+    list.push_back(std::move(value));
+    EXPECT_TRUE(value.empty());
+    EXPECT_EQ(list.front().size(), 64u);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, SpliceMovesNodesAndSizes)
+{
+    mls::List<int> a;
+    mls::List<int> b;
+    for (int v : {1, 2, 3}) { a.push_back(v); }
+    for (int v : {10, 20, 30}) { b.push_back(v); }
+    const int* twenty = &*std::next(b.begin());
+
+    a.splice(std::next(a.begin()), b, std::next(b.begin()));
+    EXPECT_TRUE(same_both_ways(a, std::vector<int>{1, 20, 2, 3}));
+    EXPECT_TRUE(same_both_ways(b, std::vector<int>{10, 30}));
+    EXPECT_EQ(&*std::next(a.begin()), twenty);
+
+    a.splice(a.end(), b, b.begin(), b.end());
+    EXPECT_TRUE(same_both_ways(a, std::vector<int>{1, 20, 2, 3, 10, 30}));
+    EXPECT_TRUE(b.empty());
+
+    b.splice(b.begin(), a);
+    EXPECT_EQ(b.size(), 6u);
+    EXPECT_TRUE(a.empty());
+
+    // within one list
+    b.splice(b.begin(), b, std::prev(b.end()));
+    EXPECT_TRUE(same_both_ways(b, std::vector<int>{30, 1, 20, 2, 3, 10}));
+}
+
+TEST(List, MergeInterleavesWithoutCopies)
+{
+    mls::List<int> a;
+    mls::List<int> b;
+    for (int v : {1, 4, 6, 9}) { a.push_back(v); }
+    for (int v : {2, 3, 7, 10, 11}) { b.push_back(v); }
+    a.merge(b, std::less<int>());
+    EXPECT_TRUE(same_both_ways(a, std::vector<int>{1, 2, 3, 4, 6, 7, 9, 10, 11}));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.begin(), b.end());
+
+    mls::List<int> c;
+    c.push_back(5);
+    a.merge(c);
+    EXPECT_EQ(a.back(), 5);
+    EXPECT_EQ(a.size(), 10u);
+}
+
+TEST(List, MergeIsStable)
+{
+    mls::List<Keyed> a;
+    mls::List<Keyed> b;
+    a.push_back(Keyed{1, 0});
+    a.push_back(Keyed{2, 0});
+    b.push_back(Keyed{1, 1});
+    b.push_back(Keyed{2, 1});
+    a.merge(b, [](const Keyed& x, const Keyed& y) { return x.key_ < y.key_; });
+    std::vector<int> seqs;
+    for (const Keyed& el : a) { seqs.push_back(el.seq_); }
+    EXPECT_EQ(seqs, (std::vector<int>{0, 1, 0, 1}));
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, RangeConstructionAndInsert)
+{
+    std::vector<int> values = {1, 2, 3, 4};
+    mls::List<int> list(values.begin(), values.end());
+    EXPECT_TRUE(same_both_ways(list, values));
+
+    auto it = list.insert(std::next(list.begin()), {7, 8});
+    EXPECT_EQ(*it, 7);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{1, 7, 8, 2, 3, 4}));
+
+    it = list.insert(list.begin(), values.end(), values.end());
+    EXPECT_EQ(it, list.begin());
+}
+
+TEST(List, FailedRangeInsertLeavesListUntouched)
+{
+    Tracked_Scope scope;
+    {
+        std::vector<Tracked> source(10);
+        mls::List<Tracked> list = {Tracked(1), Tracked(2)};
+        long before = Tracked::live;
+
+        Tracked::budget = 5;
+        EXPECT_THROW(list.insert(std::next(list.begin()), source.begin(), source.end()), std::runtime_error);
+        Tracked::budget = -1;
+
+        EXPECT_EQ(Tracked::live, before);
+        EXPECT_TRUE(same_both_ways(list, std::vector<Tracked>{Tracked(1), Tracked(2)}));
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, CopyAssignmentReusesNodes)
+{
+    mls::List<int> target = {1, 2, 3, 4};
+    const int* first = &target.front();
+    mls::List<int> source = {9, 8};
+
+    target = source;
+    EXPECT_TRUE(same_both_ways(target, std::vector<int>{9, 8}));
+    EXPECT_EQ(&target.front(), first);
+
+    mls::List<int> longer = {5, 6, 7, 8, 9};
+    target = longer;
+    EXPECT_TRUE(same_both_ways(target, std::vector<int>{5, 6, 7, 8, 9}));
+    EXPECT_EQ(&target.front(), first);
+}
+
+TEST(List, FailedCopyAssignmentKeepsOldContents)
+{
+    Tracked_Scope scope;
+    {
+        mls::List<Tracked> target = {Tracked(1)};
+        mls::List<Tracked> source = {Tracked(4), Tracked(5), Tracked(6)};
+        Tracked::budget = 1;
+        EXPECT_THROW(target = source, std::runtime_error);
+        Tracked::budget = -1;
+        EXPECT_EQ(target.size(), 1u);
+        EXPECT_EQ(target.front().value_, 1);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, ParallelSortMatchesSequentialSort)
+{
+    std::vector<int> values = shuffled(70000);
+    mls::List<int, std::allocator<int>, mls::Counting_List_Stats> list(values.begin(), values.end());
+    list.parallel_sort(std::less<int>(), 4);
+    std::sort(values.begin(), values.end());
+    EXPECT_TRUE(same_both_ways(list, values));
+    EXPECT_EQ(list.stats().sorts_, 1u);
+    EXPECT_GT(list.stats().comparisons_, 0u);
+}
+
+TEST(List, ParallelSortThrowingComparatorKeepsEveryNode)
+{
+    std::vector<int> values = shuffled(70000);
+    mls::List<int, std::allocator<int>, mls::Counting_List_Stats> counted(values.begin(), values.end());
+    counted.parallel_sort(std::less<int>(), 4);
+    const long total = static_cast<long>(counted.stats().comparisons_);
+
+    // budgets land in the per-chain sorts, the middle and the very last merge
+    for (long budget : {100L, total / 2, total - 10})
+    {
+        mls::List<int> list(values.begin(), values.end());
+        std::atomic<long> left{budget};
+        auto comp = [&left](int a, int b) {
+            if(left.fetch_sub(1) <= 0) { throw std::runtime_error("comparator"); }
+            return a < b;
+        };
+        EXPECT_THROW(list.parallel_sort(comp, 4), std::runtime_error);
+
+        std::vector<int> seen = to_vector(list);
+        EXPECT_EQ(seen.size(), values.size());
+        EXPECT_EQ(std::distance(list.rbegin(), list.rend()), 70000);
+        std::sort(seen.begin(), seen.end());
+        ASSERT_EQ(seen.front(), 0);
+        for (size_t i = 1; i < seen.size(); ++i) { ASSERT_EQ(seen[i], seen[i - 1] + 1); }
+    }
+}
+
+TEST(List, ParallelForEachVisitsEveryElementOnce)
+{
+    mls::List<int> list;
+    for (int i = 0; i < 50000; ++i) { list.push_back(1); }
+    list.parallel_for_each([](int& v) { v += 1; }, 3);
+    for (int v : list) { ASSERT_EQ(v, 2); }
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, ExtractAndReinsertKeepNode)
+{
+    mls::List<int> a = {1, 2, 3};
+    mls::List<int> b;
+    const int* two = &*std::next(a.begin());
+
+    auto handle = a.extract(std::next(a.begin()));
+    EXPECT_FALSE(handle.empty());
+    EXPECT_EQ(handle.value(), 2);
+    EXPECT_EQ(a.size(), 2u);
+
+    b.insert(b.end(), std::move(handle));
+    EXPECT_TRUE(handle.empty());
+    EXPECT_EQ(&b.front(), two);
+    EXPECT_TRUE(same_both_ways(a, std::vector<int>{1, 3}));
+
+    auto dropped = b.extract(b.begin());
+    EXPECT_TRUE(b.empty());
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, RemoveIfAndUniqueCountRemovals)
+{
+    mls::List<int> list = {1, 1, 2, 3, 3, 3, 4, 1};
+    EXPECT_EQ(list.unique(), 3u);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{1, 2, 3, 4, 1}));
+
+    EXPECT_EQ(list.remove(1), 2u);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{2, 3, 4}));
+
+    EXPECT_EQ(mls::erase_if(list, [](int v) { return v % 2 == 0; }), 2u);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{3}));
+    EXPECT_EQ(mls::erase(list, 3), 1u);
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(List, RemoveAcceptsValueStoredInList)
+{
+    mls::List<int> list = {1, 2, 1, 3};
+    EXPECT_EQ(list.remove(list.front()), 2u);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{2, 3}));
+}
+
+TEST(List, ThrowingPredicateKeepsSizeConsistent)
+{
+    mls::List<int> list = {1, 2, 3, 4, 5};
+    int calls = 0;
+    EXPECT_THROW(list.remove_if([&calls](int v) {
+        if(++calls == 4) { throw std::runtime_error("predicate"); }
+        return v % 2 == 1;
+    }), std::runtime_error);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{2, 4, 5}));
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, SentinelNeedsNoDefaultConstructor)
+{
+    static_assert(!std::is_default_constructible_v<No_Default>);
+    mls::List<No_Default> list;
+    EXPECT_TRUE(list.empty());
+    list.emplace_back(3);
+    list.push_front(No_Default(1));
+    EXPECT_EQ(list.front().value_, 1);
+    EXPECT_EQ(list.back().value_, 3);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, PmrListsKeepTheirResource)
+{
+    std::pmr::monotonic_buffer_resource pool;
+    using Pmr_List = mls::List<int, std::pmr::polymorphic_allocator<int>>;
+    Pmr_List a({1, 2, 3}, &pool);
+    Pmr_List moved(std::move(a));
+    EXPECT_EQ(moved.get_allocator().resource(), &pool);
+    EXPECT_TRUE(same_both_ways(moved, std::vector<int>{1, 2, 3}));
+
+    Pmr_List other(std::pmr::new_delete_resource());
+    other = std::move(moved);
+    EXPECT_EQ(other.get_allocator().resource(), std::pmr::new_delete_resource());
+    EXPECT_TRUE(same_both_ways(other, std::vector<int>{1, 2, 3}));
+
+    Pmr_List b({4}, &pool);
+    b.swap(other);
+    EXPECT_TRUE(same_both_ways(b, std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(b.get_allocator().resource(), &pool);
+}
+
+TEST(List, PmrElementsUseTheListResource)
+{
+    std::pmr::monotonic_buffer_resource pool;
+    using Pmr_List = mls::List<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>>;
+    const std::string long_str(100, 'x');
+    Pmr_List list(&pool);
+    list.emplace_back(long_str);
+    list.push_front(std::pmr::string(long_str, std::pmr::new_delete_resource()));
+    list.insert(list.end(), {std::pmr::string("y")});
+    for (const auto& el : list) { EXPECT_EQ(el.get_allocator().resource(), &pool); }
+
+    Pmr_List copy(list, &pool);
+    list.rehome();
+    for (const auto& el : list) { EXPECT_EQ(el.get_allocator().resource(), &pool); }
+    for (const auto& el : copy) { EXPECT_EQ(el.get_allocator().resource(), &pool); }
+    EXPECT_EQ(list.front(), long_str.c_str());
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, RehomeAndCompactKeepOrder)
+{
+    std::vector<int> values = shuffled(3000);
+    mls::List<int> list(values.begin(), values.end());
+    list.rehome();
+    EXPECT_TRUE(same_both_ways(list, values));
+    EXPECT_EQ(list.compact(), 0u);
+    EXPECT_TRUE(same_both_ways(list, values));
+}
+
+TEST(List, RehomeRepacksNonPropagatingAllocatorInPlace)
+{
+    std::pmr::unsynchronized_pool_resource pool;
+    Limited_Resource limited(&pool);
+    using Pmr_List = mls::List<std::string, std::pmr::polymorphic_allocator<std::string>>;
+    std::vector<int> values = shuffled(200);
+    Pmr_List list(&limited);
+    for (int v : values) { list.push_back(std::to_string(v)); }
+
+    list.rehome();
+    EXPECT_EQ(list.get_allocator().resource(), &limited);
+    size_t i = 0;
+    for (const std::string& el : list) { ASSERT_EQ(el, std::to_string(values[i++])); }
+
+    // room for half the new nodes only: the list must come out of the failure unchanged
+    limited.left_ = 100;
+    EXPECT_THROW(list.rehome(), std::bad_alloc);
+    EXPECT_EQ(list.size(), 200u);
+    i = 0;
+    for (const std::string& el : list) { ASSERT_EQ(el, std::to_string(values[i++])); }
+    EXPECT_EQ(std::distance(list.rbegin(), list.rend()), 200);
+}
+
+TEST(List, CompactionRunsInSlices)
+{
+    std::vector<int> values = shuffled(1000);
+    mls::List<std::string> list;
+    for (int v : values) { list.push_back(std::to_string(v)); }
+
+    auto compaction = list.compaction();
+    EXPECT_FALSE(compaction.step(300));
+    // readable between slices
+    size_t i = 0;
+    for (const std::string& el : list) { ASSERT_EQ(el, std::to_string(values[i++])); }
+    EXPECT_FALSE(compaction.run_for(std::chrono::seconds(0)));
+    EXPECT_TRUE(compaction.run_for(std::chrono::seconds(60)));
+    EXPECT_TRUE(compaction.done());
+    EXPECT_TRUE(compaction.step(1));
+
+    i = 0;
+    for (const std::string& el : list) { ASSERT_EQ(el, std::to_string(values[i++])); }
+    EXPECT_EQ(std::distance(list.rbegin(), list.rend()), 1000);
+}
+
+TEST(List, UnfinishedCompactionRestoresTheList)
+{
+    // a move that may throw makes the compaction copy and keep the originals
+    struct Copied
+    {
+        std::string value_;
+        Copied(std::string value) : value_(std::move(value)) {}
+        Copied(const Copied& other) = default;
+        Copied(Copied&& other) noexcept(false) : value_(std::move(other.value_)) {}
+    };
+
+    std::vector<int> values = shuffled(500);
+    mls::List<std::string> moved;
+    mls::List<Copied> copied;
+    for (int v : values)
+    {
+        moved.push_back(std::to_string(v));
+        copied.push_back(Copied(std::to_string(v)));
+    }
+    const std::string* last_address = &moved.back();
+    {
+        auto moving = moved.compaction();
+        auto copying = copied.compaction();
+        moving.step(200);
+        copying.step(200);
+    }
+    EXPECT_EQ(&moved.back(), last_address);
+    size_t i = 0;
+    auto it = copied.begin();
+    for (const std::string& el : moved)
+    {
+        ASSERT_EQ(el, std::to_string(values[i++]));
+        ASSERT_EQ((it++)->value_, el);
+    }
+    EXPECT_EQ(std::distance(moved.rbegin(), moved.rend()), 500);
+    EXPECT_EQ(std::distance(copied.rbegin(), copied.rend()), 500);
+    moved.push_front("front");
+    copied.erase(copied.begin());
+    EXPECT_EQ(moved.size(), 501u);
+    EXPECT_EQ(copied.size(), 499u);
+}
+
+TEST(List, CompactionStagesNonPropagatingAllocatorInPlace)
+{
+    std::pmr::unsynchronized_pool_resource pool;
+    Limited_Resource limited(&pool);
+    using Pmr_List = mls::List<std::string, std::pmr::polymorphic_allocator<std::string>>;
+    std::vector<int> values = shuffled(200);
+    Pmr_List list(&limited);
+    for (int v : values) { list.push_back(std::to_string(v)); }
+
+    auto compaction = list.compaction();
+    compaction.step(50);
+    // a failed slice leaves the compaction where it was, ready to retry
+    limited.left_ = 10;
+    EXPECT_THROW(compaction.step(50), std::bad_alloc);
+    limited.left_ = -1;
+    compaction.finish();
+    EXPECT_TRUE(compaction.done());
+    EXPECT_EQ(list.get_allocator().resource(), &limited);
+    size_t i = 0;
+    for (const std::string& el : list) { ASSERT_EQ(el, std::to_string(values[i++])); }
+    EXPECT_EQ(std::distance(list.rbegin(), list.rend()), 200);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, StatsCountAllocationsAndPeak)
+{
+    mls::List<int, std::allocator<int>, mls::Counting_List_Stats> list = {5, 4, 3, 2, 1};
+    list.pop_back();
+    list.sort();
+    mls::List_Stats stats = list.stats();
+    EXPECT_EQ(stats.constructs_, 5u);
+    EXPECT_EQ(stats.destructs_, 1u);
+    EXPECT_EQ(stats.peak_size_, 5u);
+    EXPECT_EQ(stats.sorts_, 1u);
+    EXPECT_GT(stats.comparisons_, 0u);
+    EXPECT_EQ(stats.bytes_allocated_, 5 * stats.bytes_freed_);
+
+    list.reset_stats();
+    EXPECT_EQ(list.stats().constructs_, 0u);
+    EXPECT_EQ(list.stats().peak_size_, 4u);
+}
+
+TEST(List, NoStatsPolicyCostsNoSpace)
+{
+    struct Same_Members
+    {
+        mls::List_Link fake_node_;
+        std::allocator<mls::List_Node<int>> node_alloc_;
+        size_t sz_;
+    };
+    EXPECT_EQ(sizeof(mls::List<int>), sizeof(Same_Members));
+    EXPECT_EQ(mls::List<int>().stats().constructs_, 0u);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, ClearAndEraseRangeOfTrivialPayload)
+{
+    mls::List<int, std::allocator<int>, mls::Counting_List_Stats> list = {1, 2, 3, 4, 5};
+    auto it = list.erase(std::next(list.begin()), std::prev(list.end()));
+    EXPECT_EQ(*it, 5);
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{1, 5}));
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(list.stats().destructs_, 5u);
+}
+
+TEST(List, ClearDestroysEveryElement)
+{
+    Tracked_Scope scope;
+    mls::List<Tracked> list = {Tracked(1), Tracked(2), Tracked(3)};
+    list.clear();
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, MovesAndSwapAreNoexceptForStandardAllocators)
+{
+    static_assert(std::is_nothrow_move_constructible_v<mls::List<int>>);
+    static_assert(std::is_nothrow_move_assignable_v<mls::List<int>>);
+    static_assert(std::is_nothrow_swappable_v<mls::List<int>>);
+    static_assert(!std::is_nothrow_move_assignable_v<mls::List<int, std::pmr::polymorphic_allocator<int>>>);
+
+    mls::List<int> a = {1, 2};
+    mls::List<int> b = {3};
+    swap(a, b);
+    EXPECT_TRUE(same_both_ways(a, std::vector<int>{3}));
+    EXPECT_TRUE(same_both_ways(b, std::vector<int>{1, 2}));
+
+    mls::List<int> c(std::move(b));
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(b.begin(), b.end());
+    EXPECT_TRUE(same_both_ways(c, std::vector<int>{1, 2}));
+}
+
+//----------------------------------------------------------------------------------
+TEST(List, IteratorsAreBidirectional)
+{
+    using It = mls::List<int>::iterator;
+    using Const_It = mls::List<int>::const_iterator;
+    static_assert(std::is_default_constructible_v<It>);
+    static_assert(std::is_convertible_v<It, Const_It>);
+#if defined(__cpp_lib_ranges)
+    static_assert(std::bidirectional_iterator<It>);
+    static_assert(std::bidirectional_iterator<Const_It>);
+    static_assert(std::ranges::bidirectional_range<mls::List<int>>);
+    static_assert(std::ranges::common_range<const mls::List<int>>);
+
+    mls::List<int> list = {1, 2, 3, 4, 5, 6};
+    auto evens = list | std::views::filter([](int v) { return v % 2 == 0; }) | std::views::reverse;
+    EXPECT_EQ(std::vector<int>(evens.begin(), evens.end()), (std::vector<int>{6, 4, 2}));
+#endif
+
+    mls::List<int> values = {1, 2, 3};
+    It it = values.begin();
+    Const_It cit = it;
+    EXPECT_TRUE(it == cit);
+    EXPECT_EQ(*it++, 1);
+    EXPECT_EQ(*it--, 2);
+    EXPECT_EQ(*values.rbegin(), 3);
+}
+
+TEST(List, ReverseSwapsOrder)
+{
+    mls::List<int> list = {1, 2, 3, 4};
+    list.reverse();
+    EXPECT_TRUE(same_both_ways(list, std::vector<int>{4, 3, 2, 1}));
+}
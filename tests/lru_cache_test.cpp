@@ -0,0 +1,85 @@
+#include "Lru_Cache.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+
+namespace
+{
+    struct Tracked_Hash
+    {
+        size_t operator()(const Tracked& key) const { return std::hash<int>()(key.value_); }
+    };
+}
+
+//----------------------------------------------------------------------------------
+TEST(Lru_Cache, EvictsLeastRecentlyUsed)
+{
+    mls::Lru_Cache<int, std::string, 2> cache;
+    EXPECT_FALSE(cache.put(1, "one"));
+    EXPECT_FALSE(cache.put(2, "two"));
+    ASSERT_NE(cache.get(1), nullptr);
+
+    EXPECT_TRUE(cache.put(3, "three"));
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_EQ(*cache.get(1), "one");
+    EXPECT_EQ(*cache.peek(3), "three");
+    EXPECT_EQ(cache.get(2), nullptr);
+    EXPECT_EQ(cache.hits(), 2u);
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(Lru_Cache, OverwriteRefreshesRecency)
+{
+    mls::Lru_Cache<std::string, int, 3> cache;
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+    EXPECT_FALSE(cache.put("a", 10));
+    cache.put("d", 4);
+
+    EXPECT_FALSE(cache.contains("b"));
+    EXPECT_EQ(*cache.peek("a"), 10);
+    EXPECT_TRUE(cache.erase("c"));
+    EXPECT_FALSE(cache.erase("c"));
+    EXPECT_EQ(cache.size(), 2u);
+
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+    cache.put("e", 5);
+    EXPECT_EQ(*cache.get("e"), 5);
+}
+
+TEST(Lru_Cache, ThrowingKeyCopyEvictsConsistently)
+{
+    Tracked_Scope scope;
+    // budget 0 fails the index key, budget 1 the chain key after the index key was taken
+    for (long budget : {0, 1})
+    {
+        mls::Lru_Cache<Tracked, std::string, 2, Tracked_Hash> cache;
+        cache.put(Tracked(1), "one");
+        cache.put(Tracked(2), "two");
+
+        Tracked::budget = budget;
+        EXPECT_THROW(cache.put(Tracked(3), "three"), std::runtime_error);
+        Tracked::budget = -1;
+        EXPECT_EQ(cache.size(), 1u);
+        EXPECT_FALSE(cache.contains(Tracked(1)));
+        EXPECT_FALSE(cache.contains(Tracked(3)));
+        EXPECT_EQ(*cache.peek(Tracked(2)), "two");
+
+        // later evictions must find every chained key in the index
+        for (int key = 4; key < 10; ++key) { cache.put(Tracked(key), std::to_string(key)); }
+        EXPECT_EQ(cache.size(), 2u);
+        EXPECT_EQ(*cache.get(Tracked(9)), "9");
+        EXPECT_EQ(*cache.get(Tracked(8)), "8");
+    }
+}
@@ -0,0 +1,101 @@
+#include "Mpsc_List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+
+//----------------------------------------------------------------------------------
+TEST(Mpsc_List, SingleThreadFifo)
+{
+    mls::Mpsc_List<std::string> list;
+    EXPECT_TRUE(list.empty());
+    list.push_back("a");
+    list.emplace_back(3, 'b');
+
+    std::string out;
+    EXPECT_TRUE(list.try_pop_front(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(list.pop_front(), "bbb");
+    EXPECT_FALSE(list.try_pop_front(out));
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(Mpsc_List, ProducersKeepTheirOwnOrder)
+{
+    constexpr int producers = 4;
+    constexpr int per_producer = 5000;
+    mls::Mpsc_List<std::pair<int, int>> list;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&list, p]() {
+            for (int i = 0; i < per_producer; ++i) { list.emplace_back(p, i); }
+        });
+    }
+
+    std::vector<int> next(producers, 0);
+    for (int received = 0; received < producers * per_producer; ++received)
+    {
+        auto [p, i] = list.pop_front();
+        ASSERT_EQ(i, next[p]);
+        ++next[p];
+    }
+    for (auto& thread : threads) { thread.join(); }
+    EXPECT_TRUE(list.empty());
+}
+
+TEST(Mpsc_List, DestructorFreesUnpoppedElements)
+{
+    Tracked_Scope scope;
+    {
+        mls::Mpsc_List<Tracked> list;
+        for (int i = 0; i < 10; ++i) { list.emplace_back(i); }
+        Tracked out;
+        EXPECT_TRUE(list.try_pop_front(out));
+        EXPECT_EQ(out.value_, 0);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Mpsc_List, ThrowingConstructionPublishesNothing)
+{
+    Tracked_Scope scope;
+    {
+        mls::Mpsc_List<Tracked> list;
+        Tracked source(1);
+        Tracked::budget = 0;
+        EXPECT_THROW(list.push_back(source), std::runtime_error);
+        Tracked::budget = -1;
+        EXPECT_TRUE(list.empty());
+        list.push_back(source);
+        EXPECT_EQ(list.pop_front().value_, 1);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Mpsc_List, PolymorphicAllocatorReachesElements)
+{
+    std::pmr::synchronized_pool_resource pool;
+    mls::Mpsc_List<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> list(&pool);
+    std::thread producer([&list]() {
+        for (int i = 0; i < 100; ++i) { list.emplace_back(50, 'x'); }
+    });
+    for (int i = 0; i < 50; ++i)
+    {
+        // a move keeps the allocator, so this shows what the element was built with
+        std::pmr::string el = list.pop_front();
+        ASSERT_EQ(el.size(), 50u);
+        ASSERT_EQ(el.get_allocator().resource(), &pool);
+    }
+    producer.join();
+}
@@ -0,0 +1,34 @@
+#include "Parallel_List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using mls_test::same_both_ways;
+
+//----------------------------------------------------------------------------------
+TEST(Parallel_List, PoliciesSortAndVisit)
+{
+    std::vector<int> values(40000);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(1));
+
+    mls::List<int> list(values.begin(), values.end());
+    mls::sort(std::execution::par, list);
+    std::sort(values.begin(), values.end());
+    EXPECT_TRUE(same_both_ways(list, values));
+
+    mls::sort(std::execution::seq, list, std::greater<int>());
+    EXPECT_EQ(list.front(), 39999);
+
+    mls::for_each(std::execution::par, list, [](int& v) { v = 1; });
+    long sum = 0;
+    mls::for_each(std::execution::seq, list, [&sum](int v) { sum += v; });
+    EXPECT_EQ(sum, 40000);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mls_test
+{
+    //----------------------------------------------------------------------------------
+    template<typename C>
+    auto to_vector(const C& c)
+    {
+        return std::vector<std::decay_t<decltype(*c.begin())>>(c.begin(), c.end());
+    }
+
+    // Checks that next_/prev_ agree in both directions against the expected contents.
+    template<typename C, typename T>
+    bool same_both_ways(const C& c, const std::vector<T>& expected)
+    {
+        if(c.size() != expected.size()) { return false; }
+        if(!std::equal(c.begin(), c.end(), expected.begin(), expected.end())) { return false; }
+        return std::equal(c.rbegin(), c.rend(), expected.rbegin(), expected.rend());
+    }
+
+    //----------------------------------------------------------------------------------
+    // Payload whose copies, moves or comparisons throw once a shared budget runs out;
+    // live counts every object alive, so leaks and double destroys show up in tests.
+    struct Tracked
+    {
+        static inline long live = 0;
+        static inline long budget = -1;
+
+        int value_;
+
+        static void spend()
+        {
+            if(budget == 0) { throw std::runtime_error("Tracked: budget exhausted"); }
+            if(budget > 0) { --budget; }
+        }
+
+        Tracked(int value = 0) : value_(value) { ++live; }
+        Tracked(const Tracked& other) : value_(other.value_)
+        {
+            spend();
+            ++live;
+        }
+        Tracked(Tracked&& other) noexcept : value_(other.value_) { ++live; }
+        Tracked& operator=(const Tracked& other)
+        {
+            spend();
+            value_ = other.value_;
+            return *this;
+        }
+        Tracked& operator=(Tracked&& other) noexcept
+        {
+            value_ = other.value_;
+            return *this;
+        }
+        ~Tracked() { --live; }
+
+        friend bool operator==(const Tracked& a, const Tracked& b) { return a.value_ == b.value_; }
+        friend bool operator<(const Tracked& a, const Tracked& b)
+        {
+            spend();
+            return a.value_ < b.value_;
+        }
+    };
+
+    // Resets Tracked's counters around a test.
+    struct Tracked_Scope
+    {
+        Tracked_Scope() { Tracked::live = 0; Tracked::budget = -1; }
+        ~Tracked_Scope() { Tracked::budget = -1; }
+    };
+    //----------------------------------------------------------------------------------
+}
@@ -0,0 +1,143 @@
+#include "Unrolled_List.hpp"
+#include "test_support.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+using mls_test::Tracked;
+using mls_test::Tracked_Scope;
+using mls_test::same_both_ways;
+
+//----------------------------------------------------------------------------------
+TEST(Unrolled_List, PushPopAtBothEnds)
+{
+    mls::Unrolled_List<int, 4> list;
+    for (int i = 0; i < 10; ++i) { list.push_back(i); }
+    for (int i = -1; i >= -5; --i) { list.push_front(i); }
+    EXPECT_EQ(list.size(), 15u);
+    EXPECT_EQ(list.front(), -5);
+    EXPECT_EQ(list.back(), 9);
+
+    list.pop_back();
+    list.pop_front();
+    std::vector<int> expected = {-4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_TRUE(same_both_ways(list, expected));
+}
+
+TEST(Unrolled_List, RandomEditsMatchStdList)
+{
+    mls::Unrolled_List<std::string, 8> list;
+    std::list<std::string> model;
+    std::mt19937 gen(11);
+
+    for (int step = 0; step < 4000; ++step)
+    {
+        size_t pos = model.empty() ? 0 : gen() % (model.size() + 1);
+        if(model.empty() || gen() % 3) {
+            std::string value = std::to_string(step);
+            auto it = list.insert(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(pos)), value);
+            ASSERT_EQ(*it, value);
+            model.insert(std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)), value);
+        } else {
+            pos = pos % model.size();
+            auto it = list.erase(std::next(list.cbegin(), static_cast<std::ptrdiff_t>(pos)));
+            auto model_it = model.erase(std::next(model.begin(), static_cast<std::ptrdiff_t>(pos)));
+            ASSERT_EQ(it == list.end(), model_it == model.end());
+            if(model_it != model.end()) { ASSERT_EQ(*it, *model_it); }
+        }
+    }
+    EXPECT_TRUE(same_both_ways(list, std::vector<std::string>(model.begin(), model.end())));
+}
+
+TEST(Unrolled_List, CopyMoveAndClearReleaseEverything)
+{
+    Tracked_Scope scope;
+    {
+        mls::Unrolled_List<Tracked, 4> list;
+        for (int i = 0; i < 30; ++i) { list.emplace_back(i); }
+        mls::Unrolled_List<Tracked, 4> copy(list);
+        mls::Unrolled_List<Tracked, 4> moved(std::move(list));
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(copy.size(), 30u);
+        EXPECT_EQ(moved.size(), 30u);
+        EXPECT_EQ(Tracked::live, 60);
+
+        copy = moved;
+        EXPECT_EQ(Tracked::live, 60);
+        moved.clear();
+        EXPECT_EQ(Tracked::live, 30);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Unrolled_List, ThrowingEmplaceLeavesListIntact)
+{
+    Tracked_Scope scope;
+    {
+        mls::Unrolled_List<Tracked, 4> list = {Tracked(1), Tracked(2), Tracked(3), Tracked(4)};
+        Tracked source(9);
+        Tracked::budget = 0;
+        EXPECT_THROW(list.push_back(source), std::runtime_error);
+        EXPECT_THROW(list.push_front(source), std::runtime_error);
+        Tracked::budget = -1;
+        EXPECT_EQ(list.size(), 4u);
+        EXPECT_EQ(Tracked::live, 5);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(Unrolled_List, PolymorphicAllocatorReachesElements)
+{
+    std::pmr::monotonic_buffer_resource pool;
+    using Pmr_List = mls::Unrolled_List<std::pmr::string, 4, std::pmr::polymorphic_allocator<std::pmr::string>>;
+    Pmr_List list(&pool);
+    for (int i = 0; i < 20; ++i) { list.push_back(std::pmr::string(40, static_cast<char>('a' + i))); }
+    list.insert(std::next(list.begin(), 3), "inserted in the middle of a full node");
+    list.erase(std::next(list.begin(), 10));
+
+    EXPECT_EQ(list.size(), 20u);
+    for (const std::pmr::string& el : list) { ASSERT_EQ(el.get_allocator().resource(), &pool); }
+    EXPECT_EQ(*std::next(list.begin(), 3), "inserted in the middle of a full node");
+}
+
+TEST(Unrolled_List, PolymorphicAllocatorMovesCopiesAndSwaps)
+{
+    std::pmr::monotonic_buffer_resource pool;
+    std::pmr::monotonic_buffer_resource other_pool;
+    using Pmr_List = mls::Unrolled_List<std::pmr::string, 4, std::pmr::polymorphic_allocator<std::pmr::string>>;
+    Pmr_List list(&pool);
+    for (int i = 0; i < 10; ++i) { list.push_back(std::pmr::string(40, static_cast<char>('a' + i))); }
+
+    // a copy does not inherit a polymorphic_allocator's resource
+    Pmr_List copy(list);
+    EXPECT_EQ(copy.size(), 10u);
+    EXPECT_EQ(copy.front().get_allocator().resource(), std::pmr::get_default_resource());
+
+    Pmr_List moved(std::move(list));
+    EXPECT_EQ(moved.size(), 10u);
+    EXPECT_TRUE(list.empty());
+    for (const std::pmr::string& el : moved) { ASSERT_EQ(el.get_allocator().resource(), &pool); }
+
+    Pmr_List assigned(&other_pool);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 10u);
+    for (const std::pmr::string& el : assigned) { ASSERT_EQ(el.get_allocator().resource(), &other_pool); }
+
+    assigned = copy;
+    EXPECT_EQ(assigned.back(), std::string(40, 'j').c_str());
+    for (const std::pmr::string& el : assigned) { ASSERT_EQ(el.get_allocator().resource(), &other_pool); }
+
+    Pmr_List small(&pool);
+    small.push_back("x");
+    small.swap(assigned);
+    EXPECT_EQ(small.size(), 10u);
+    EXPECT_EQ(assigned.size(), 1u);
+    for (const std::pmr::string& el : small) { ASSERT_EQ(el.get_allocator().resource(), &pool); }
+    EXPECT_EQ(assigned.front().get_allocator().resource(), &other_pool);
+}